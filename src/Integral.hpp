@@ -27,31 +27,2445 @@
 #ifndef INTEGRAL_CSP_H__
 #define INTEGRAL_CSP_H__
 
-#include <stack>
+#include <array>
+#include <string>
 #include <limits>
-#include <bitset>
-#include <iosfwd>
-#include <sstream>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
 #include <exception>
 #include <stdexcept>
 #include <type_traits>
+#include <string_view>
+#include <system_error>
+
+/*
+ * Kernels targeting instruction set extensions beyond the compilation target
+ * are compiled with per-function target attributes and selected at runtime
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define INTEGRAL_CSP_X86 1
+#include <immintrin.h>
+#endif
+
+/*
+ * Constant evaluation cannot execute those kernels, the portable path is
+ * taken instead; without compiler support the portable path is always taken
+ */
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define INTEGRAL_CSP_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#endif
+
+#if !defined(INTEGRAL_CSP_CONSTANT_EVALUATED)
+#define INTEGRAL_CSP_CONSTANT_EVALUATED() true
+#endif
+
+/*
+ * Bit reversal is a single instruction (RBIT) on some targets, which only
+ * some compilers expose
+ */
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_bitreverse64)
+#define INTEGRAL_CSP_BITREVERSE 1
+#endif
+#endif
 
 namespace compuSUAVE_Professional {
 
+/**
+ * @brief Outcome of a parse operation, modelled after std::from_chars_result
+ *
+ * - ptr points one past the last character that was consumed, or to the first
+ *   character of the input if no digits were found
+ * - ec is value initialized on success, std::errc::invalid_argument if no
+ *   digits were found and std::errc::result_out_of_range if the digits
+ *   represent a value that cannot be held by the target type
+ */
+struct ParseResult {
+    const char* ptr;
+    std::errc   ec;
+};
+
+/**
+ * @brief Outcome of a formatting operation, modelled after
+ *        std::to_chars_result
+ *
+ * - ptr points one past the last character written, or to the end of the
+ *   supplied range if it is too small to hold the representation
+ * - ec is value initialized on success, std::errc::value_too_large if the
+ *   range is too small and std::errc::invalid_argument for an unsupported
+ *   radix
+ */
+struct ToCharsResult {
+    char*     ptr;
+    std::errc ec;
+};
+
+/**
+ * @brief Null terminated string with inline storage for up to Capacity
+ *        characters
+ *
+ * Used to hand out textual representations by value without touching the
+ * heap. The object converts to a C-String which remains valid for as long as
+ * the object itself.
+ */
+template<std::size_t Capacity>
+class FixedString final {
+
+public:
+
+    /**
+     * @brief Default constructor
+     *
+     * Creates an empty string
+     */
+    constexpr FixedString() noexcept
+    : m_data{}, m_size{0} {}
+
+    /**
+     * @brief Get the maximum number of characters the string can hold
+     *
+     * @return Capacity excluding the null terminator
+     */
+    constexpr static std::size_t capacity() noexcept {
+        return Capacity;
+    }
+
+    /**
+     * @brief Get the number of characters held
+     *
+     * @return Length excluding the null terminator
+     */
+    constexpr std::size_t size() const noexcept {
+        return m_size;
+    }
+
+    /**
+     * @brief Sets the length of the string and null terminates it
+     *
+     * @param size New length which must not exceed the capacity
+     */
+    constexpr void resize(const std::size_t size) noexcept {
+        m_size = size;
+        m_data[size] = '\0';
+    }
+
+    /**
+     * @brief Get access to the underlying character storage
+     *
+     * @return Pointer to the first character
+     */
+    constexpr char* data() noexcept {
+        return m_data;
+    }
+
+    /**
+     * @brief Get access to the underlying character storage
+     *
+     * @return Pointer to the first character
+     */
+    constexpr const char* data() const noexcept {
+        return m_data;
+    }
+
+    /**
+     * @brief Get the null terminated representation
+     *
+     * @return Pointer to the first character
+     */
+    constexpr const char* c_str() const noexcept {
+        return m_data;
+    }
+
+    /**
+     * @brief Get an iterator to the first character
+     */
+    constexpr const char* begin() const noexcept {
+        return m_data;
+    }
+
+    /**
+     * @brief Get an iterator one past the last character
+     */
+    constexpr const char* end() const noexcept {
+        return m_data + m_size;
+    }
+
+    /**
+     * @brief Converts the object to a C-String
+     *
+     * @return Pointer to the null terminated characters
+     */
+    constexpr operator const char*() const noexcept {
+        return m_data;
+    }
+
+    /**
+     * @brief Get a view of the characters held
+     *
+     * @return View over the characters excluding the null terminator
+     */
+    constexpr std::string_view view() const noexcept {
+        return std::string_view{m_data, m_size};
+    }
+
+    /**
+     * @brief Compares the characters held by two strings of any capacity
+     *
+     * @param lhs Left hand operand
+     * @param rhs Right hand operand
+     *
+     * @return True if both hold the same characters, false otherwise
+     */
+    template<std::size_t OtherCapacity>
+    friend constexpr bool operator ==(const FixedString& lhs,
+                                      const FixedString<OtherCapacity>& rhs)
+                                      noexcept {
+        return lhs.view() == rhs.view();
+    }
+
+    /**
+     * @brief Compares the characters held by two strings of any capacity
+     *
+     * @param lhs Left hand operand
+     * @param rhs Right hand operand
+     *
+     * @return True if the characters differ, false otherwise
+     */
+    template<std::size_t OtherCapacity>
+    friend constexpr bool operator !=(const FixedString& lhs,
+                                      const FixedString<OtherCapacity>& rhs)
+                                      noexcept {
+        return !(lhs == rhs);
+    }
+
+    /**
+     * @brief Compares the characters held with a C-String
+     *
+     * - Usable in constant expressions, unlike std::strcmp
+     *
+     * @param lhs Left hand operand
+     * @param rhs Null terminated right hand operand
+     *
+     * @return True if both hold the same characters, false otherwise
+     */
+    friend constexpr bool operator ==(const FixedString& lhs,
+                                      const char* rhs) noexcept {
+        std::size_t index = 0;
+        while ((index < lhs.m_size) && (lhs.m_data[index] == rhs[index])) {
+            ++index;
+        }
+        return (index == lhs.m_size) && (rhs[index] == '\0');
+    }
+
+    /**
+     * @brief Compares the characters held with a C-String
+     *
+     * @param lhs Null terminated left hand operand
+     * @param rhs Right hand operand
+     *
+     * @return True if both hold the same characters, false otherwise
+     */
+    friend constexpr bool operator ==(const char* lhs,
+                                      const FixedString& rhs) noexcept {
+        return rhs == lhs;
+    }
+
+    /**
+     * @brief Compares the characters held with a C-String
+     *
+     * @param lhs Left hand operand
+     * @param rhs Null terminated right hand operand
+     *
+     * @return True if the characters differ, false otherwise
+     */
+    friend constexpr bool operator !=(const FixedString& lhs,
+                                      const char* rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+    /**
+     * @brief Compares the characters held with a C-String
+     *
+     * @param lhs Null terminated left hand operand
+     * @param rhs Right hand operand
+     *
+     * @return True if the characters differ, false otherwise
+     */
+    friend constexpr bool operator !=(const char* lhs,
+                                      const FixedString& rhs) noexcept {
+        return !(rhs == lhs);
+    }
+
+private:
+    char        m_data[Capacity + 1]; //< Characters and null terminator
+    std::size_t m_size;               //< Number of characters held
+
+}; //< FixedString<Capacity>
+
+//=========================================================================
+// Implementation Details
+//=========================================================================
+namespace detail {
+
+#if defined(__SIZEOF_INT128__)
+/*
+ * 128-bit integers of the compiler, spelled through __extension__ so that
+ * pedantic builds accept them
+ */
+__extension__ typedef __int128          Int128;
+__extension__ typedef unsigned __int128 UInt128;
+#endif
+
+/*
+ * Integral type traits that also cover the 128-bit integers, which the
+ * standard traits only recognize in the GNU dialects of the language
+ */
+template<typename T>
+struct IntegralTraits {
+    static constexpr bool integral  = std::is_integral<T>::value;
+    static constexpr bool is_signed = std::is_signed<T>::value;
+    static constexpr int  digits    = std::numeric_limits<T>::digits;
+
+    using unsigned_type = std::make_unsigned_t<T>;
+
+    static constexpr T min() noexcept { return std::numeric_limits<T>::min(); }
+    static constexpr T max() noexcept { return std::numeric_limits<T>::max(); }
+};
+
+#if defined(__SIZEOF_INT128__)
+template<>
+struct IntegralTraits<Int128> {
+    static constexpr bool integral  = true;
+    static constexpr bool is_signed = true;
+    static constexpr int  digits    = 127;
+
+    using unsigned_type = UInt128;
+
+    static constexpr Int128 min() noexcept { return -max() - 1; }
+    static constexpr Int128 max() noexcept {
+        return static_cast<Int128>(~UInt128{} >> 1);
+    }
+};
+
+template<>
+struct IntegralTraits<UInt128> {
+    static constexpr bool integral  = true;
+    static constexpr bool is_signed = false;
+    static constexpr int  digits    = 128;
+
+    using unsigned_type = UInt128;
+
+    static constexpr UInt128 min() noexcept { return 0; }
+    static constexpr UInt128 max() noexcept { return ~UInt128{}; }
+};
+#endif
+
+template<typename T>
+using MakeUnsigned = typename IntegralTraits<T>::unsigned_type;
+
+/*
+ * Instruction set extensions of the executing processor
+ */
+struct CpuFeatures {
+    bool ssse3;
+    bool sse41;
+    bool avx2;
+    bool avx512bw;
+    bool bmi2;      //< PDEP/PEXT are present
+    bool fast_bmi2; //< PDEP/PEXT are not microcoded
+};
+
+/*
+ * Queries the executing processor once and caches the outcome
+ */
+inline const CpuFeatures& cpuFeatures() noexcept {
+    static const CpuFeatures features = [] {
+        CpuFeatures detected{};
+#if defined(INTEGRAL_CSP_X86)
+        __builtin_cpu_init();
+        detected.ssse3     = __builtin_cpu_supports("ssse3");
+        detected.sse41     = __builtin_cpu_supports("sse4.1");
+        detected.avx2      = __builtin_cpu_supports("avx2");
+        detected.avx512bw  = __builtin_cpu_supports("avx512bw");
+        detected.bmi2      = __builtin_cpu_supports("bmi2");
+        detected.fast_bmi2 = detected.bmi2 &&
+                             !__builtin_cpu_is("znver1") &&
+                             !__builtin_cpu_is("znver2");
+#endif
+        return detected;
+    }();
+    return features;
+}
+
+/*
+ * Whitespace as classified by std::isspace in the "C" locale
+ */
+constexpr bool isSpace(const char c) noexcept {
+    return (c == ' ') || (static_cast<unsigned char>(c - '\t') < 5);
+}
+
+/*
+ * Value of an alphanumeric digit in any radix up to 36, any other character
+ * maps to 36 so that a single comparison against the radix rejects it
+ */
+constexpr unsigned digitValue(const char c) noexcept {
+    return (static_cast<unsigned char>(c - '0') < 10)
+           ? static_cast<unsigned char>(c - '0')
+           : (static_cast<unsigned char>((c | 0x20) - 'a') < 26)
+           ? static_cast<unsigned char>((c | 0x20) - 'a') + 10u
+           : 36u;
+}
+
+/*
+ * Length of a null terminated C-String
+ */
+constexpr std::size_t length(const char* value) noexcept {
+    std::size_t size = 0;
+    while (value[size] != '\0') ++size;
+    return size;
+}
+
+/*
+ * Lookup tables of the decimal parsing and formatting kernels
+ *
+ * Wrapped in a class template so that the definitions may live in this header
+ */
+template<typename Unused = void>
+struct DecimalTables {
+
+    // Two character representations of 00 through 99
+    static constexpr char pairs[201] =
+        "0001020304050607080910111213141516171819202122232425262728293031323334353637383940414243444546474849"
+        "5051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+    // Powers of ten representable by a 64-bit unsigned integer
+    static constexpr std::uint64_t powers[20] = {
+        1ULL,                   10ULL,
+        100ULL,                 1000ULL,
+        10000ULL,               100000ULL,
+        1000000ULL,             10000000ULL,
+        100000000ULL,           1000000000ULL,
+        10000000000ULL,         100000000000ULL,
+        1000000000000ULL,       10000000000000ULL,
+        100000000000000ULL,     1000000000000000ULL,
+        10000000000000000ULL,   100000000000000000ULL,
+        1000000000000000000ULL, 10000000000000000000ULL
+    };
+};
+
+template<typename Unused>
+constexpr char DecimalTables<Unused>::pairs[201];
+
+template<typename Unused>
+constexpr std::uint64_t DecimalTables<Unused>::powers[20];
+
+/*
+ * Accumulates the digits of the specified radix found at the start of
+ * [first, last) into magnitude, recording any wrap-around in overflow
+ *
+ * The radix is a template parameter so that the multiplication reduces to
+ * shifts and adds for every supported base
+ */
+template<unsigned Radix, typename U>
+constexpr const char* accumulateDigits(const char* first, const char* last,
+                                       U& magnitude, bool& overflow)
+                                       noexcept {
+    for (; first != last; ++first) {
+        const unsigned digit = digitValue(*first);
+        if (digit >= Radix) {
+            break;
+        }
+        overflow |= __builtin_mul_overflow(magnitude, static_cast<U>(Radix),
+                                           &magnitude);
+        overflow |= __builtin_add_overflow(magnitude, static_cast<U>(digit),
+                                           &magnitude);
+    }
+    return first;
+}
+
+/*
+ * Appends a run of decimal digits, already converted to their value, to the
+ * magnitude accumulated so far
+ */
+template<typename U>
+inline void appendDecimal(U& magnitude, const std::uint64_t digits,
+                          const unsigned count, bool& overflow) noexcept {
+    overflow |= __builtin_mul_overflow(magnitude, DecimalTables<>::powers[count],
+                                       &magnitude);
+    overflow |= __builtin_add_overflow(magnitude, digits, &magnitude);
+}
+
+/*
+ * Validates and converts up to eight decimal digits held in a 64-bit word,
+ * lowest addressed character in the lowest byte
+ *
+ * Every byte is flagged as a non-digit without crossing byte boundaries, the
+ * digits before the first flagged byte are moved to the top of the word so
+ * that the vacated bytes act as leading zeros, then pairs, quads and octets
+ * of digits are combined with three multiplications
+ */
+inline std::uint32_t parseDigits8Swar(std::uint64_t chars,
+                                      unsigned& count) noexcept {
+    const std::uint64_t values   = chars ^ 0x3030303030303030ULL;
+    const std::uint64_t invalid  = (values & 0xF0F0F0F0F0F0F0F0ULL) |
+                                   (((values & 0x0F0F0F0F0F0F0F0FULL) +
+                                     0x0606060606060606ULL) &
+                                    0x1010101010101010ULL);
+    const std::uint64_t flagged  = (((invalid & 0x7F7F7F7F7F7F7F7FULL) +
+                                     0x7F7F7F7F7F7F7F7FULL) | invalid) &
+                                   0x8080808080808080ULL;
+
+    count = flagged ? (static_cast<unsigned>(__builtin_ctzll(flagged)) >> 3) : 8u;
+    if (count == 0) {
+        return 0;
+    }
+
+    std::uint64_t digits = values << (64u - (count * 8u));
+    digits = (digits * 10u) + (digits >> 8);
+    digits = (((digits & 0x000000FF000000FFULL) * (100u + (1000000ULL << 32))) +
+              (((digits >> 16) & 0x000000FF000000FFULL) * (1u + (10000ULL << 32))))
+             >> 32;
+    return static_cast<std::uint32_t>(digits);
+}
+
+/*
+ * Decimal accumulation eight digits at a time on general purpose registers,
+ * the tail shorter than a word is handled one digit at a time
+ */
+template<typename U>
+inline const char* accumulateDecimalSwar(const char* first, const char* last,
+                                         U& magnitude, bool& overflow)
+                                         noexcept {
+    // Types narrower than 32 bits cannot hold eight digits
+    if (sizeof(U) >= 4) {
+        while ((last - first) >= 8) {
+            std::uint64_t chars;
+            std::memcpy(&chars, first, sizeof chars);
+
+            unsigned count;
+            const std::uint32_t digits = parseDigits8Swar(chars, count);
+            if (count == 0) {
+                return first;
+            }
+
+            appendDecimal(magnitude, digits, count, overflow);
+            first += count;
+            if (count < 8) {
+                return first;
+            }
+        }
+    }
+    return accumulateDigits<10>(first, last, magnitude, overflow);
+}
+
+#if defined(INTEGRAL_CSP_X86)
+/*
+ * Validates and converts up to sixteen decimal digits with multiply-add
+ * reductions: the digits before the first non-digit are shuffled to the top
+ * of the register behind zero bytes, then pairs, quads and octets of digits
+ * are combined by maddubs, madd and packus/madd respectively
+ */
+__attribute__((target("sse4.1")))
+inline std::uint64_t parseDigits16Sse41(const char* first,
+                                        unsigned& count) noexcept {
+    const __m128i chars  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+    const __m128i values = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+    const __m128i valid  = _mm_cmpeq_epi8(_mm_min_epu8(values, _mm_set1_epi8(9)),
+                                          values);
+    const unsigned invalid = ~static_cast<unsigned>(_mm_movemask_epi8(valid)) & 0xFFFFu;
+
+    count = static_cast<unsigned>(__builtin_ctz(invalid | 0x10000u));
+    if (count == 0) {
+        return 0;
+    }
+
+    const __m128i shift  = _mm_add_epi8(_mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8,
+                                                      9, 10, 11, 12, 13, 14, 15),
+                                        _mm_set1_epi8(static_cast<char>(count - 16u)));
+    const __m128i digits = _mm_shuffle_epi8(values, shift);
+
+    const __m128i pairs  = _mm_maddubs_epi16(digits, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1,
+                                                                   10, 1, 10, 1, 10, 1, 10, 1));
+    const __m128i quads  = _mm_madd_epi16(pairs, _mm_setr_epi16(100, 1, 100, 1,
+                                                                100, 1, 100, 1));
+    const __m128i packed = _mm_packus_epi32(quads, quads);
+    const __m128i octets = _mm_madd_epi16(packed, _mm_setr_epi16(10000, 1, 10000, 1,
+                                                                 10000, 1, 10000, 1));
+
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm_cvtsi128_si32(octets))) * 100000000u) +
+           static_cast<std::uint32_t>(_mm_extract_epi32(octets, 1));
+}
+
+/*
+ * Decimal accumulation sixteen digits at a time, the tail shorter than a
+ * register is handled by the SWAR kernel; callers check for SSE4.1 unless
+ * compiling for a target that has it
+ */
+template<typename U>
+inline const char* accumulateDecimalSse41(const char* first, const char* last,
+                                          U& magnitude, bool& overflow)
+                                          noexcept {
+    while ((last - first) >= 16) {
+        unsigned count;
+        const std::uint64_t digits = parseDigits16Sse41(first, count);
+        if (count == 0) {
+            return first;
+        }
+
+        appendDecimal(magnitude, digits, count, overflow);
+        first += count;
+        if (count < 16) {
+            return first;
+        }
+    }
+    return accumulateDecimalSwar(first, last, magnitude, overflow);
+}
+#endif
+
+/*
+ * Decimal accumulation at runtime, sixteen digit chunks are only worth it
+ * for 64-bit types as narrower ones overflow long before
+ *
+ * Unlike the formatting kernels the SSE4.1 path is selected when compiling
+ * for a target that has it rather than at runtime: a token takes only a few
+ * nanoseconds and a call that cannot be inlined costs more than it saves
+ */
+template<typename U>
+inline const char* accumulateDecimal(const char* first, const char* last,
+                                     U& magnitude, bool& overflow) noexcept {
+#if defined(__SSE4_1__)
+    if (sizeof(U) >= 8) {
+        return accumulateDecimalSse41(first, last, magnitude, overflow);
+    }
+#endif
+    return accumulateDecimalSwar(first, last, magnitude, overflow);
+}
+
+/*
+ * Parsing engine shared by every textual entry point of Integral<T>
+ *
+ * Skips leading whitespace, accepts an optional sign and selects the radix
+ * from the prefix: "0b"/"0B" for binary, "0x"/"0X" for hexadecimal, a leading
+ * "0" for octal and decimal otherwise. Negative input for an unsigned type
+ * wraps around as it does for std::strtoull. On overflow the value is clamped
+ * to the nearest representable value, on invalid input it is left untouched.
+ */
+template<typename T>
+constexpr ParseResult parseIntegral(const char* first, const char* last,
+                                    T& value) noexcept {
+    using U = MakeUnsigned<T>;
+
+    const char* it = first;
+    while ((it != last) && isSpace(*it)) {
+        ++it;
+    }
+
+    bool negative = false;
+    if ((it != last) && ((*it == '+') || (*it == '-'))) {
+        negative = (*it == '-');
+        ++it;
+    }
+
+    // A prefix without a digit behind it is the octal zero followed by junk
+    unsigned radix = 10;
+    if ((it != last) && (*it == '0')) {
+        radix = 8;
+        if ((last - it) > 2) {
+            const char marker = static_cast<char>(it[1] | 0x20);
+            if ((marker == 'x') && (digitValue(it[2]) < 16)) {
+                radix = 16;
+                it += 2;
+            } else if ((marker == 'b') && (digitValue(it[2]) < 2)) {
+                radix = 2;
+                it += 2;
+            }
+        }
+    }
+
+    U    magnitude = 0;
+    bool overflow  = false;
+
+    const char* const digits = it;
+    switch (radix) {
+        case 2:  it = accumulateDigits<2>(it, last, magnitude, overflow);  break;
+        case 8:  it = accumulateDigits<8>(it, last, magnitude, overflow);  break;
+        case 16: it = accumulateDigits<16>(it, last, magnitude, overflow); break;
+        default: it = INTEGRAL_CSP_CONSTANT_EVALUATED()
+                      ? accumulateDigits<10>(it, last, magnitude, overflow)
+                      : accumulateDecimal(it, last, magnitude, overflow);
+                 break;
+    }
+
+    if (it == digits) {
+        return {first, std::errc::invalid_argument};
+    }
+
+    // Signed types hold one more negative value than positive ones
+    const U limit = IntegralTraits<T>::is_signed
+                    ? static_cast<U>(static_cast<U>(IntegralTraits<T>::max())
+                                     + negative)
+                    : IntegralTraits<U>::max();
+
+    if (overflow || (magnitude > limit)) {
+        value = (negative && IntegralTraits<T>::is_signed)
+                ? IntegralTraits<T>::min()
+                : IntegralTraits<T>::max();
+        return {it, std::errc::result_out_of_range};
+    }
+
+    value = static_cast<T>(negative ? static_cast<U>(U{} - magnitude)
+                                    : magnitude);
+    return {it, std::errc{}};
+}
+
+/*
+ * Widest unsigned type a literal is accumulated in
+ */
+#if defined(__SIZEOF_INT128__)
+using LiteralWord = UInt128;
+#else
+using LiteralWord = unsigned long long;
+#endif
+
+/*
+ * Value of a raw integer literal as seen by a literal operator template
+ *
+ * valid is cleared by any character outside the literal's radix, which also
+ * rejects floating point literals, and overflow is set for values beyond
+ * LiteralWord.
+ */
+struct LiteralValue {
+    LiteralWord value;
+    bool        valid;
+    bool        overflow;
+};
+
+/*
+ * Parses the characters of an integer literal, including its "0x"/"0X",
+ * "0b"/"0B" or "0" prefix and any digit separators
+ */
+template<char... Chars>
+constexpr LiteralValue parseLiteral() noexcept {
+    constexpr std::size_t size = sizeof...(Chars);
+    constexpr char literal[size + 1] = {Chars..., '\0'};
+
+    unsigned    radix = 10;
+    std::size_t index = 0;
+    if (literal[0] == '0') {
+        radix = 8;
+        const char marker = static_cast<char>(literal[1] | 0x20);
+        if (marker == 'x') {
+            radix = 16;
+            index = 2;
+        } else if (marker == 'b') {
+            radix = 2;
+            index = 2;
+        }
+    }
+
+    LiteralValue result{0, index < size, false};
+    for (; index < size; ++index) {
+        if (literal[index] == '\'') {
+            continue;
+        }
+        const unsigned digit = digitValue(literal[index]);
+        if (digit >= radix) {
+            result.valid = false;
+            break;
+        }
+        result.overflow |= __builtin_mul_overflow(result.value, radix,
+                                                  &result.value);
+        result.overflow |= __builtin_add_overflow(result.value, digit,
+                                                  &result.value);
+    }
+    return result;
+}
+
+/*
+ * Character of a digit in any radix up to 36, lower case as produced by
+ * std::to_chars
+ */
+constexpr char digitChar(const unsigned digit) noexcept {
+    return "0123456789abcdefghijklmnopqrstuvwxyz"[digit];
+}
+
+/*
+ * Formatting engine shared by every textual representation of Integral<T>
+ *
+ * Digits are produced least significant first into a local buffer sized for
+ * the binary representation of U and copied to [first, last) once their
+ * count is known, so nothing is written on failure.
+ */
+template<typename U>
+constexpr ToCharsResult formatUnsigned(char* first, char* last, U value,
+                                       const unsigned radix) noexcept {
+    char buffer[IntegralTraits<U>::digits] = {};
+
+    char* const buffer_end = buffer + IntegralTraits<U>::digits;
+    char* digit = buffer_end;
+    do {
+        *--digit = digitChar(static_cast<unsigned>(value % radix));
+        value = static_cast<U>(value / radix);
+    } while (value != 0);
+
+    if ((last - first) < (buffer_end - digit)) {
+        return {last, std::errc::value_too_large};
+    }
+
+    while (digit != buffer_end) {
+        *first++ = *digit++;
+    }
+    return {first, std::errc{}};
+}
+
+/*
+ * Number of digits of the largest value of U in the specified radix, enough
+ * to represent the bit pattern of any value of U
+ */
+template<typename U>
+constexpr std::size_t maxDigits(const unsigned radix) noexcept {
+    std::size_t count = 1;
+    for (U value = IntegralTraits<U>::max(); value >= radix;
+         value = static_cast<U>(value / radix)) {
+        ++count;
+    }
+    return count;
+}
+
+/*
+ * Fixed width unsigned type of the same size as U, the decimal kernel is
+ * specialized per width rather than per fundamental type
+ */
+template<typename U>
+using FixedWidth =
+    std::conditional_t<sizeof(U) == 1, std::uint8_t,
+    std::conditional_t<sizeof(U) == 2, std::uint16_t,
+    std::conditional_t<sizeof(U) == 4, std::uint32_t,
+#if defined(__SIZEOF_INT128__)
+    std::conditional_t<sizeof(U) == 8, std::uint64_t, UInt128>>>>;
+#else
+    std::uint64_t>>>;
+#endif
+
+/*
+ * Number of decimal digits of a value, computed without loops
+ *
+ * Narrow widths sum the outcome of a few comparisons. Wider ones estimate
+ * log10 from the bit width (1233 / 4096 approximates log10(2)) and correct the
+ * estimate with a single comparison against the table of powers.
+ */
+constexpr unsigned decimalDigits(const std::uint8_t value) noexcept {
+    return 1u + (value >= 10u) + (value >= 100u);
+}
+
+constexpr unsigned decimalDigits(const std::uint16_t value) noexcept {
+    return 1u + (value >= 10u) + (value >= 100u) + (value >= 1000u)
+              + (value >= 10000u);
+}
+
+constexpr unsigned decimalDigits(const std::uint32_t value) noexcept {
+    const unsigned estimate = ((32u - __builtin_clz(value | 1u)) * 1233u) >> 12;
+    return estimate + 1u - ((value | 1u) < DecimalTables<>::powers[estimate]);
+}
+
+constexpr unsigned decimalDigits(const std::uint64_t value) noexcept {
+    const unsigned estimate = ((64u - __builtin_clzll(value | 1u)) * 1233u) >> 12;
+    return estimate + 1u - ((value | 1u) < DecimalTables<>::powers[estimate]);
+}
+
+#if defined(__SIZEOF_INT128__)
+/*
+ * 128-bit values are split into chunks of nineteen digits, the most a 64-bit
+ * word holds, so that the digits of each chunk come from the 64-bit kernels
+ */
+constexpr std::uint64_t decimalChunk = 10000000000000000000ULL;
+
+constexpr unsigned decimalDigits(const UInt128 value) noexcept {
+    return (value >> 64) == 0
+           ? decimalDigits(static_cast<std::uint64_t>(value))
+           : 19u + decimalDigits(static_cast<UInt128>(value / decimalChunk));
+}
+#endif
+
+/*
+ * Writes the decimal digits of a value backwards from end, two digits per
+ * step, the caller must have reserved decimalDigits(value) characters
+ */
+template<typename Fixed>
+constexpr void writeDecimal(char* end, Fixed value) noexcept {
+    while (value >= 100u) {
+        const unsigned pair = static_cast<unsigned>(value % 100u) * 2u;
+        value = static_cast<Fixed>(value / 100u);
+        *--end = DecimalTables<>::pairs[pair + 1];
+        *--end = DecimalTables<>::pairs[pair];
+    }
+    if (value >= 10u) {
+        const unsigned pair = static_cast<unsigned>(value) * 2u;
+        *--end = DecimalTables<>::pairs[pair + 1];
+        *--end = DecimalTables<>::pairs[pair];
+    } else {
+        *--end = static_cast<char>('0' + value);
+    }
+}
+
+/*
+ * 64-bit values only divide in 64 bits while they do not fit 32 bits, which
+ * is at most five steps, the remaining digits use the cheaper 32-bit kernel
+ */
+constexpr void writeDecimal(char* end, std::uint64_t value) noexcept {
+    while (value > 0xFFFFFFFFULL) {
+        const unsigned pair = static_cast<unsigned>(value % 100u) * 2u;
+        value /= 100u;
+        *--end = DecimalTables<>::pairs[pair + 1];
+        *--end = DecimalTables<>::pairs[pair];
+    }
+    writeDecimal(end, static_cast<std::uint32_t>(value));
+}
+
+#if defined(__SIZEOF_INT128__)
+/*
+ * 128-bit values take at most two 128-bit divisions, one per chunk of
+ * nineteen digits below the leading one, every chunk is padded with zeros
+ */
+constexpr void writeDecimal(char* end, UInt128 value) noexcept {
+    while ((value >> 64) != 0) {
+        const UInt128 high = value / decimalChunk;
+        char* const chunk = end - 19;
+        for (char* it = chunk; it != end; ++it) {
+            *it = '0';
+        }
+        writeDecimal(end, static_cast<std::uint64_t>(value - (high * decimalChunk)));
+        end   = chunk;
+        value = high;
+    }
+    writeDecimal(end, static_cast<std::uint64_t>(value));
+}
+#endif
+
+/*
+ * Decimal formatting kernel, sizes the output up front and fills it from the
+ * least significant digit pair
+ */
+template<typename U>
+constexpr ToCharsResult formatDecimal(char* first, char* last,
+                                      const U value) noexcept {
+    const FixedWidth<U> fixed = value;
+    const unsigned count = decimalDigits(fixed);
+
+    if ((last - first) < static_cast<std::ptrdiff_t>(count)) {
+        return {last, std::errc::value_too_large};
+    }
+
+    writeDecimal(first + count, fixed);
+    return {first + count, std::errc{}};
+}
+
+/*
+ * Number of significant bits of a value, at least one so that zero is
+ * represented by a single digit
+ */
+template<typename U>
+constexpr unsigned significantBits(const U value) noexcept {
+    return (sizeof(U) <= sizeof(unsigned))
+           ? 32u - __builtin_clz(static_cast<unsigned>(value) | 1u)
+           : 64u - __builtin_clzll(static_cast<unsigned long long>(value) | 1u);
+}
+
+/*
+ * Spreads the eight nibbles of a 32-bit value over the bytes of a 64-bit
+ * word, most significant nibble in the lowest addressed byte
+ */
+inline std::uint64_t spreadNibbles(const std::uint32_t value) noexcept {
+    std::uint64_t spread = value;
+    spread = (spread | (spread << 16)) & 0x0000FFFF0000FFFFULL;
+    spread = (spread | (spread << 8))  & 0x00FF00FF00FF00FFULL;
+    spread = (spread | (spread << 4))  & 0x0F0F0F0F0F0F0F0FULL;
+    return __builtin_bswap64(spread);
+}
+
+/*
+ * Converts eight nibbles held one per byte to their lower case hexadecimal
+ * characters without branching: bytes of ten or more carry into bit four
+ * once six is added, selecting the extra distance from '9' to 'a'
+ */
+inline std::uint64_t nibblesToHex(const std::uint64_t nibbles) noexcept {
+    const std::uint64_t letters =
+        ((nibbles + 0x0606060606060606ULL) >> 4) & 0x0101010101010101ULL;
+    return nibbles + 0x3030303030303030ULL + (letters * ('a' - '9' - 1));
+}
+
+/*
+ * Writes all sixteen hexadecimal digits of a 64-bit value using SWAR
+ * arithmetic on general purpose registers
+ */
+inline void hexDigitsSwar(char* out, const std::uint64_t value) noexcept {
+    const std::uint64_t high = nibblesToHex(spreadNibbles(static_cast<std::uint32_t>(value >> 32)));
+    const std::uint64_t low  = nibblesToHex(spreadNibbles(static_cast<std::uint32_t>(value)));
+    std::memcpy(out,     &high, sizeof high);
+    std::memcpy(out + 8, &low,  sizeof low);
+}
+
+#if defined(INTEGRAL_CSP_X86)
+/*
+ * Writes all sixteen hexadecimal digits of a 64-bit value with a single
+ * byte shuffle through a table of the sixteen digit characters
+ */
+__attribute__((target("ssse3")))
+inline void hexDigitsSsse3(char* out, const std::uint64_t value) noexcept {
+    const __m128i bytes  = _mm_cvtsi64_si128(static_cast<long long>(__builtin_bswap64(value)));
+    const __m128i mask   = _mm_set1_epi8(0x0F);
+    const __m128i high   = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+    const __m128i low    = _mm_and_si128(bytes, mask);
+    const __m128i digits = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
+                                         '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+    const __m128i chars  = _mm_shuffle_epi8(digits, _mm_unpacklo_epi8(high, low));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), chars);
+}
+#endif
+
+/*
+ * Hexadecimal formatting kernel, renders every digit of the widened value at
+ * once and keeps the significant ones
+ */
+template<typename U>
+inline ToCharsResult formatHex(char* first, char* last, const U value) noexcept {
+    const unsigned count = (significantBits(value) + 3u) / 4u;
+
+    if ((last - first) < static_cast<std::ptrdiff_t>(count)) {
+        return {last, std::errc::value_too_large};
+    }
+
+    char digits[16];
+#if defined(INTEGRAL_CSP_X86)
+    if (cpuFeatures().ssse3) {
+        hexDigitsSsse3(digits, value);
+    } else
+#endif
+    {
+        hexDigitsSwar(digits, value);
+    }
+
+    std::memcpy(first, digits + (16u - count), count);
+    return {first + count, std::errc{}};
+}
+
+/*
+ * Expands the eight bits of a byte to their binary digit characters, most
+ * significant bit in the lowest addressed byte: the byte is replicated into
+ * every lane, each lane isolates one bit and adding 0x7F moves a set bit to
+ * the top of the lane
+ */
+inline std::uint64_t expandBitsMultiply(const unsigned byte) noexcept {
+    const std::uint64_t isolated = (byte * 0x0101010101010101ULL)
+                                   & 0x0102040810204080ULL;
+    return (((isolated + 0x7F7F7F7F7F7F7F7FULL) >> 7) & 0x0101010101010101ULL)
+           | 0x3030303030303030ULL;
+}
+
+#if defined(INTEGRAL_CSP_X86)
+/*
+ * Expands the eight bits of a byte with a single bit deposit
+ */
+__attribute__((target("bmi2")))
+inline std::uint64_t expandBitsPdep(const unsigned byte) noexcept {
+    return __builtin_bswap64(_pdep_u64(byte, 0x0101010101010101ULL))
+           | 0x3030303030303030ULL;
+}
+
+/*
+ * Writes the binary digits of the specified number of bytes of a value,
+ * kept apart so that the deposit instruction is inlined into the loop
+ */
+__attribute__((target("bmi2")))
+inline void binaryDigitsPdep(char* out, const std::uint64_t value,
+                             unsigned bytes) noexcept {
+    while (bytes-- > 0) {
+        const std::uint64_t chars = expandBitsPdep(static_cast<unsigned>(value >> (bytes * 8u)) & 0xFFu);
+        std::memcpy(out, &chars, sizeof chars);
+        out += 8;
+    }
+}
+#endif
+
+/*
+ * Binary formatting kernel, renders eight digits per step for every byte
+ * holding significant bits and keeps the significant digits
+ */
+template<typename U>
+inline ToCharsResult formatBinary(char* first, char* last, const U value) noexcept {
+    const unsigned count = significantBits(value);
+    const unsigned bytes = (count + 7u) / 8u;
+
+    if ((last - first) < static_cast<std::ptrdiff_t>(count)) {
+        return {last, std::errc::value_too_large};
+    }
+
+    char digits[64];
+    char* const out = digits + (64u - (bytes * 8u));
+    const std::uint64_t wide = value;
+
+#if defined(INTEGRAL_CSP_X86)
+    if (cpuFeatures().fast_bmi2) {
+        binaryDigitsPdep(out, wide, bytes);
+    } else
+#endif
+    {
+        char* it = out;
+        for (unsigned byte = bytes; byte-- > 0; it += 8) {
+            const std::uint64_t chars = expandBitsMultiply(static_cast<unsigned>(wide >> (byte * 8u)) & 0xFFu);
+            std::memcpy(it, &chars, sizeof chars);
+        }
+    }
+
+    std::memcpy(first, digits + (64u - count), count);
+    return {first + count, std::errc{}};
+}
+
+/*
+ * Selects the formatting kernel for the specified radix, during constant
+ * evaluation the hexadecimal and binary kernels give way to the generic one
+ * as they rely on intrinsics and std::memcpy
+ */
+template<typename U>
+constexpr ToCharsResult formatRadix(char* first, char* last, const U value,
+                                    const unsigned radix) noexcept {
+    if (INTEGRAL_CSP_CONSTANT_EVALUATED() && (radix != 10)) {
+        return formatUnsigned(first, last, value, radix);
+    }
+
+    switch (radix) {
+        case 2:  return formatBinary(first, last, value);
+        case 10: return formatDecimal(first, last, value);
+        case 16: return formatHex(first, last, value);
+        default: return formatUnsigned(first, last, value, radix);
+    }
+}
+
+#if defined(__SIZEOF_INT128__)
+/*
+ * 128-bit hexadecimal and binary formatting, the 64-bit kernels render the
+ * upper half and then the lower half padded with zeros to its full width
+ */
+inline ToCharsResult formatHalves(char* first, char* last, const UInt128 value,
+                                  const unsigned radix) noexcept {
+    const auto high = static_cast<std::uint64_t>(value >> 64);
+    const auto low  = static_cast<std::uint64_t>(value);
+
+    auto kernel = [radix](char* begin, char* end, const std::uint64_t half) {
+        return (radix == 16) ? formatHex(begin, end, half)
+                             : formatBinary(begin, end, half);
+    };
+
+    if (high == 0) {
+        return kernel(first, last, low);
+    }
+
+    const unsigned width = (radix == 16) ? 16u : 64u;
+    const unsigned upper = (radix == 16) ? (significantBits(high) + 3u) / 4u
+                                         : significantBits(high);
+    if ((last - first) < static_cast<std::ptrdiff_t>(upper + width)) {
+        return {last, std::errc::value_too_large};
+    }
+
+    first = kernel(first, last, high).ptr;
+
+    char digits[64];
+    const std::size_t count = static_cast<std::size_t>(
+        kernel(digits, digits + width, low).ptr - digits);
+    std::memset(first, '0', width - count);
+    std::memcpy(first + (width - count), digits, count);
+    return {first + width, std::errc{}};
+}
+
+/*
+ * 128-bit counterpart of the kernel selection above
+ */
+constexpr ToCharsResult formatRadix(char* first, char* last, const UInt128 value,
+                                    const unsigned radix) noexcept {
+    if (INTEGRAL_CSP_CONSTANT_EVALUATED() && (radix != 10)) {
+        return formatUnsigned(first, last, value, radix);
+    }
+
+    switch (radix) {
+        case 2:
+        case 16: return formatHalves(first, last, value, radix);
+        case 10: return formatDecimal(first, last, value);
+        default: return formatUnsigned(first, last, value, radix);
+    }
+}
+#endif
+
+/*
+ * Stream extraction engine, reads the characters that can belong to a
+ * number straight from the stream buffer into a buffer on the stack
+ *
+ * Accepts an optional sign and the radix prefixes of parseIntegral, stops on
+ * the first character that cannot continue the number and leaves it in the
+ * stream. Leading zeros are not stored so that the buffer only needs room
+ * for the significant digits of the widest representation. Sets failbit
+ * and zero if no digits were found, failbit and the clamped value if the
+ * number does not fit the type and eofbit if the end of the stream was hit.
+ */
+template<typename T>
+std::istream& extractIntegral(std::istream& cin, T& value) {
+    using U      = MakeUnsigned<T>;
+    using traits = std::istream::traits_type;
+
+    const std::istream::sentry guard{cin};
+    if (!guard) {
+        return cin;
+    }
+
+    char buffer[IntegralTraits<U>::digits + 4];
+    std::size_t size = 0;
+
+    std::streambuf* const source = cin.rdbuf();
+    traits::int_type c = source->sgetc();
+
+    auto accept = [&](const char character) {
+        buffer[size++] = character;
+        c = source->snextc();
+    };
+    auto current = [&] {
+        return traits::eq_int_type(c, traits::eof()) ? '\0' : traits::to_char_type(c);
+    };
+
+    if ((current() == '+') || (current() == '-')) {
+        accept(current());
+    }
+
+    // A prefix without a digit behind it is the octal zero followed by junk,
+    // as in parseIntegral, so the marker is put back into the stream
+    unsigned radix  = 10;
+    bool     broken = false;
+    if (current() == '0') {
+        accept('0');
+        radix = 8;
+        const char marker = static_cast<char>(current() | 0x20);
+        if ((marker == 'x') || (marker == 'b')) {
+            const unsigned prefixed = (marker == 'x') ? 16 : 2;
+            c = source->snextc();
+            if (digitValue(current()) < prefixed) {
+                buffer[size++] = marker;
+                radix = prefixed;
+            } else if (traits::eq_int_type(source->sungetc(), traits::eof())) {
+                broken = true;
+            } else {
+                c = source->sgetc();
+            }
+        }
+    }
+
+    bool significant = false;
+    bool truncated   = false;
+    while (!traits::eq_int_type(c, traits::eof()) && (digitValue(current()) < radix)) {
+        const char digit = current();
+        c = source->snextc();
+
+        if (!significant && (digit == '0')) {
+            continue;
+        }
+        significant = true;
+
+        if (size == sizeof buffer) {
+            truncated = true;
+        } else {
+            buffer[size++] = digit;
+        }
+    }
+
+    std::ios_base::iostate state = std::ios_base::goodbit;
+    if (traits::eq_int_type(c, traits::eof())) {
+        state |= std::ios_base::eofbit;
+    }
+
+    value = T{};
+    const ParseResult result = parseIntegral(buffer, buffer + size, value);
+    if (truncated) {
+        value = (buffer[0] == '-') && IntegralTraits<T>::is_signed
+                ? IntegralTraits<T>::min()
+                : IntegralTraits<T>::max();
+        state |= std::ios_base::failbit;
+    } else if (broken || (result.ec != std::errc{})) {
+        state |= std::ios_base::failbit;
+    }
+
+    cin.setstate(state);
+    return cin;
+}
+
+/*
+ * Stream insertion engine, formats into a buffer on the stack and hands the
+ * characters to the stream buffer in one call
+ *
+ * Honors the basefield, showbase, showpos, uppercase and adjustfield flags,
+ * the width and the fill character of the stream. Hexadecimal and octal
+ * representations show the bit pattern of negative values as the standard
+ * inserters do.
+ */
+template<typename T>
+std::ostream& insertIntegral(std::ostream& cout, const T value) {
+    using U = MakeUnsigned<T>;
+
+    const std::ostream::sentry guard{cout};
+    if (!guard) {
+        return cout;
+    }
+
+    const std::ios_base::fmtflags flags = cout.flags();
+    const std::ios_base::fmtflags base  = flags & std::ios_base::basefield;
+
+    char buffer[IntegralTraits<U>::digits + 4];
+    char* first = buffer;
+    char* const last = buffer + sizeof buffer;
+
+    // Characters before this position are the sign and radix prefix
+    char* digits = buffer;
+
+    if ((base == std::ios_base::hex) || (base == std::ios_base::oct)) {
+        const bool hexadecimal = (base == std::ios_base::hex);
+        if ((flags & std::ios_base::showbase) && (value != T{})) {
+            *first++ = '0';
+            if (hexadecimal) {
+                *first++ = (flags & std::ios_base::uppercase) ? 'X' : 'x';
+            }
+        }
+
+        // The octal prefix is a leading digit rather than a prefix to pad
+        digits = hexadecimal ? first : buffer;
+        first  = formatRadix(first, last, static_cast<U>(value),
+                             hexadecimal ? 16u : 8u).ptr;
+        if (hexadecimal && (flags & std::ios_base::uppercase)) {
+            // The end of the buffer bounds the loop for the compiler as well
+            for (char* it = digits; (it != first) && (it != last); ++it) {
+                if (*it >= 'a') {
+                    *it = static_cast<char>(*it - ('a' - 'A'));
+                }
+            }
+        }
+    } else {
+        U magnitude = static_cast<U>(value);
+        if (value < T{}) {
+            *first++  = '-';
+            magnitude = static_cast<U>(U{} - magnitude);
+        } else if (flags & std::ios_base::showpos) {
+            *first++ = '+';
+        }
+        digits = first;
+        first  = formatDecimal(first, last, magnitude).ptr;
+    }
+
+    const std::streamsize size    = first - buffer;
+    const std::streamsize width   = cout.width(0);
+    const std::streamsize padding = (width > size) ? (width - size) : 0;
+    const std::ios_base::fmtflags adjust = flags & std::ios_base::adjustfield;
+
+    std::streambuf* const sink = cout.rdbuf();
+    const char fill = cout.fill();
+    bool written = true;
+
+    auto pad = [&] {
+        for (std::streamsize i = 0; i < padding; ++i) {
+            written &= !std::ostream::traits_type::eq_int_type(sink->sputc(fill),
+                                                               std::ostream::traits_type::eof());
+        }
+    };
+
+    if (adjust == std::ios_base::internal) {
+        written &= (sink->sputn(buffer, digits - buffer) == (digits - buffer));
+        pad();
+        written &= (sink->sputn(digits, first - digits) == (first - digits));
+    } else {
+        if (adjust != std::ios_base::left) {
+            pad();
+        }
+        written &= (sink->sputn(buffer, size) == size);
+        if (adjust == std::ios_base::left) {
+            pad();
+        }
+    }
+
+    if (!written) {
+        cout.setstate(std::ios_base::badbit);
+    }
+    return cout;
+}
+
+/*
+ * Outcome of an arithmetic operation: the result wrapped modulo 2^N, whether
+ * the exact result does not fit T and the bound saturating arithmetic clamps
+ * it to. Overflow policies select what they need and the optimizer discards
+ * the rest.
+ */
+template<typename T>
+struct ArithmeticResult {
+    T    wrapped;
+    bool overflow;
+    T    bound;
+};
+
+/*
+ * Whether a value is below zero, always false for unsigned types
+ */
+template<typename T>
+constexpr bool isNegative(const T value) noexcept {
+    return IntegralTraits<T>::is_signed && (value < T{});
+}
+
+template<typename T>
+constexpr ArithmeticResult<T> addOverflow(const T lhs, const T rhs) noexcept {
+    ArithmeticResult<T> result{T{}, false, isNegative(rhs)
+                                           ? IntegralTraits<T>::min()
+                                           : IntegralTraits<T>::max()};
+    result.overflow = __builtin_add_overflow(lhs, rhs, &result.wrapped);
+    return result;
+}
+
+template<typename T>
+constexpr ArithmeticResult<T> subOverflow(const T lhs, const T rhs) noexcept {
+    ArithmeticResult<T> result{T{}, false, (IntegralTraits<T>::is_signed
+                                            && isNegative(rhs))
+                                           ? IntegralTraits<T>::max()
+                                           : IntegralTraits<T>::min()};
+    result.overflow = __builtin_sub_overflow(lhs, rhs, &result.wrapped);
+    return result;
+}
+
+template<typename T>
+constexpr ArithmeticResult<T> mulOverflow(const T lhs, const T rhs) noexcept {
+    ArithmeticResult<T> result{T{}, false, (isNegative(lhs) != isNegative(rhs))
+                                           ? IntegralTraits<T>::min()
+                                           : IntegralTraits<T>::max()};
+    result.overflow = __builtin_mul_overflow(lhs, rhs, &result.wrapped);
+    return result;
+}
+
+/*
+ * Division overflows for the minimum of a signed type divided by minus one,
+ * which is a negation and wraps to the minimum. A zero divisor is only
+ * tested for policies that report it, where it yields zero and saturates
+ * towards the sign of the dividend; for the others it remains a
+ * precondition of the hardware division. Minus one is tested first and on
+ * its own, so the wrapping policy compiles to the two branches of a
+ * hand-written guarded division instead of combining flags.
+ */
+template<typename T>
+constexpr ArithmeticResult<T> divOverflow(const T lhs, const T rhs,
+                                          std::false_type) noexcept {
+    if (IntegralTraits<T>::is_signed && (rhs == static_cast<T>(-1))) {
+        return subOverflow(T{}, lhs);
+    }
+    return {static_cast<T>(lhs / rhs), false, T{}};
+}
+
+template<typename T>
+constexpr ArithmeticResult<T> divOverflow(const T lhs, const T rhs,
+                                          std::true_type) noexcept {
+    if (IntegralTraits<T>::is_signed && (rhs == static_cast<T>(-1))) {
+        return subOverflow(T{}, lhs);
+    }
+    ArithmeticResult<T> result{T{}, true, isNegative(lhs)
+                                          ? IntegralTraits<T>::min()
+                                          : IntegralTraits<T>::max()};
+    if (rhs != T{}) {
+        result = {static_cast<T>(lhs / rhs), false, T{}};
+    }
+    return result;
+}
+
+/*
+ * The remainder of the minimum of a signed type divided by minus one is
+ * zero and fits, only a zero divisor overflows for policies reporting it
+ */
+template<typename T>
+constexpr ArithmeticResult<T> modOverflow(const T lhs, const T rhs,
+                                          std::false_type) noexcept {
+    if (IntegralTraits<T>::is_signed && (rhs == static_cast<T>(-1))) {
+        return {T{}, false, T{}};
+    }
+    return {static_cast<T>(lhs % rhs), false, T{}};
+}
+
+template<typename T>
+constexpr ArithmeticResult<T> modOverflow(const T lhs, const T rhs,
+                                          std::true_type) noexcept {
+    const bool zero = (rhs == T{});
+    if (zero || (IntegralTraits<T>::is_signed
+                 && (rhs == static_cast<T>(-1)))) {
+        return {T{}, zero, T{}};
+    }
+    return {static_cast<T>(lhs % rhs), false, T{}};
+}
+
+/*
+ * Word the dividers compute in, narrower types are promoted to 32 bits
+ */
+template<typename T>
+using DividerWord =
+    std::conditional_t<IntegralTraits<T>::is_signed,
+                       std::conditional_t<(sizeof(T) <= 4), std::int32_t,
+                                                            std::int64_t>,
+                       std::conditional_t<(sizeof(T) <= 4), std::uint32_t,
+                                                            std::uint64_t>>;
+
+/*
+ * Integral type of twice the width of T and the same signedness, T itself
+ * when no wider type exists
+ */
+template<typename T>
+using Widened =
+    std::conditional_t<(sizeof(T) == 1),
+                       std::conditional_t<IntegralTraits<T>::is_signed,
+                                          std::int16_t, std::uint16_t>,
+    std::conditional_t<(sizeof(T) == 2),
+                       std::conditional_t<IntegralTraits<T>::is_signed,
+                                          std::int32_t, std::uint32_t>,
+    std::conditional_t<(sizeof(T) == 4),
+                       std::conditional_t<IntegralTraits<T>::is_signed,
+                                          std::int64_t, std::uint64_t>,
+#if defined(__SIZEOF_INT128__)
+    std::conditional_t<(sizeof(T) == 8),
+                       std::conditional_t<IntegralTraits<T>::is_signed,
+                                          Int128, UInt128>,
+                       T>>>>;
+#else
+                       T>>>;
+#endif
+
+/*
+ * High half of the full product of two words, narrower types take it from
+ * their widened product
+ */
+template<typename T>
+constexpr T mulHigh(const T lhs, const T rhs) noexcept {
+    return static_cast<T>((static_cast<Widened<T>>(lhs)
+                           * static_cast<Widened<T>>(rhs))
+                          >> (sizeof(T) * 8u));
+}
+
+/*
+ * High half of the full product of two words
+ */
+constexpr std::uint32_t mulHigh(const std::uint32_t lhs,
+                                const std::uint32_t rhs) noexcept {
+    return static_cast<std::uint32_t>((std::uint64_t{lhs} * rhs) >> 32);
+}
+
+constexpr std::int32_t mulHigh(const std::int32_t lhs,
+                               const std::int32_t rhs) noexcept {
+    return static_cast<std::int32_t>((std::int64_t{lhs} * rhs) >> 32);
+}
+
+#if defined(__SIZEOF_INT128__)
+constexpr std::uint64_t mulHigh(const std::uint64_t lhs,
+                                const std::uint64_t rhs) noexcept {
+    return static_cast<std::uint64_t>(
+        (static_cast<UInt128>(lhs) * rhs) >> 64);
+}
+
+constexpr std::int64_t mulHigh(const std::int64_t lhs,
+                               const std::int64_t rhs) noexcept {
+    return static_cast<std::int64_t>((static_cast<Int128>(lhs) * rhs) >> 64);
+}
+#else
+constexpr std::uint64_t mulHigh(const std::uint64_t lhs,
+                                const std::uint64_t rhs) noexcept {
+    const std::uint64_t low    = (lhs & 0xFFFFFFFFu) * (rhs & 0xFFFFFFFFu);
+    const std::uint64_t middle = (lhs >> 32) * (rhs & 0xFFFFFFFFu) + (low >> 32);
+    const std::uint64_t cross  = (middle & 0xFFFFFFFFu)
+                                 + (lhs & 0xFFFFFFFFu) * (rhs >> 32);
+    return (lhs >> 32) * (rhs >> 32) + (middle >> 32) + (cross >> 32);
+}
+
+constexpr std::int64_t mulHigh(const std::int64_t lhs,
+                               const std::int64_t rhs) noexcept {
+    const std::uint64_t high = mulHigh(static_cast<std::uint64_t>(lhs),
+                                       static_cast<std::uint64_t>(rhs));
+    return static_cast<std::int64_t>(
+        high - ((lhs < 0) ? static_cast<std::uint64_t>(rhs) : 0u)
+             - ((rhs < 0) ? static_cast<std::uint64_t>(lhs) : 0u));
+}
+#endif
+
+/*
+ * Quotient of (high * 2^N) / divisor for an N-bit U, which fits U as high
+ * must be less than the divisor, and its remainder
+ */
+template<typename U>
+constexpr U wideQuotient(const U high, const U divisor, U& remainder)
+                         noexcept {
+    constexpr unsigned bits = IntegralTraits<U>::digits;
+#if defined(__SIZEOF_INT128__)
+    using Wide = std::conditional_t<(bits == 32), std::uint64_t,
+                                                  UInt128>;
+    const Wide numerator = static_cast<Wide>(high) << bits;
+    remainder = static_cast<U>(numerator % divisor);
+    return static_cast<U>(numerator / divisor);
+#else
+    U quotient = 0;
+    remainder  = high;
+    for (unsigned bit = 0; bit < bits; ++bit) {
+        const bool carry = (remainder >> (bits - 1)) != 0;
+        remainder = static_cast<U>(remainder << 1);
+        quotient  = static_cast<U>(quotient << 1);
+        if (carry || (remainder >= divisor)) {
+            remainder = static_cast<U>(remainder - divisor);
+            quotient |= 1u;
+        }
+    }
+    return quotient;
+#endif
+}
+
+/*
+ * Flags kept next to the shift amount of the dividers
+ */
+constexpr std::uint8_t dividerShiftMask = 0x3F;
+constexpr std::uint8_t dividerAdd       = 0x40; //< Magic number needs N + 1 bits
+constexpr std::uint8_t dividerNegative  = 0x80; //< Divisor is negative
+
+/*
+ * Division of unsigned words by an invariant divisor as described by
+ * Granlund and Montgomery, "Division by Invariant Integers using
+ * Multiplication", with the refinements of libdivide: powers of two are a
+ * plain shift, and magic numbers that fit the word skip the fix-up step
+ */
+template<typename U>
+struct UnsignedDivider {
+    U            magic;
+    std::uint8_t more;
+
+    static constexpr UnsignedDivider generate(const U divisor) noexcept {
+        const unsigned floor_log2 = significantBits(divisor) - 1;
+        if ((divisor & (divisor - 1)) == 0) {
+            return {0, static_cast<std::uint8_t>(floor_log2)};
+        }
+
+        // 2^(N + floor_log2) / divisor, which is exact enough if the error
+        // is below 2^floor_log2, the next power of two is needed otherwise
+        U remainder = 0;
+        U magic = wideQuotient(static_cast<U>(U{1} << floor_log2), divisor,
+                               remainder);
+        std::uint8_t more = static_cast<std::uint8_t>(floor_log2);
+        if ((divisor - remainder) >= (U{1} << floor_log2)) {
+            const U twice = static_cast<U>(remainder + remainder);
+            magic = static_cast<U>(magic + magic
+                                   + ((twice >= divisor) || (twice < remainder)));
+            more |= dividerAdd;
+        }
+        return {static_cast<U>(magic + 1), more};
+    }
+
+    constexpr U divide(const U numerator) const noexcept {
+        if (magic == 0) {
+            return numerator >> more;
+        }
+        const U high = mulHigh(magic, numerator);
+        if (more & dividerAdd) {
+            const U sum = static_cast<U>(((numerator - high) >> 1) + high);
+            return sum >> (more & dividerShiftMask);
+        }
+        return high >> more;
+    }
+};
+
+/*
+ * Branch free division of unsigned words in the original form of Granlund
+ * and Montgomery: a single magic number and two shifts cover every divisor,
+ * one and the powers of two included, so a vector of numerators follows the
+ * same instruction sequence
+ */
+template<typename U>
+struct UnsignedBranchfreeDivider {
+    U            magic;
+    std::uint8_t shift1;
+    std::uint8_t shift2;
+
+    static constexpr UnsignedBranchfreeDivider generate(const U divisor)
+                                                        noexcept {
+        // ceil(log2(divisor)), 2^ceil_log2 wraps to zero for the largest
+        // divisors which still yields 2^ceil_log2 - divisor modulo 2^N
+        const unsigned ceil_log2 = (divisor == 1)
+                                   ? 0u : significantBits(divisor - 1);
+        const U power = (ceil_log2 == 0)
+                        ? U{1} : static_cast<U>(U{2} << (ceil_log2 - 1));
+        U remainder = 0;
+        const U magic = wideQuotient(static_cast<U>(power - divisor), divisor,
+                                     remainder);
+        return {static_cast<U>(magic + 1),
+                static_cast<std::uint8_t>((ceil_log2 < 1) ? ceil_log2 : 1u),
+                static_cast<std::uint8_t>((ceil_log2 > 1) ? ceil_log2 - 1 : 0u)};
+    }
+
+    constexpr U divide(const U numerator) const noexcept {
+        const U high = mulHigh(magic, numerator);
+        return static_cast<U>(high + ((numerator - high) >> shift1)) >> shift2;
+    }
+};
+
+/*
+ * Division of signed words by an invariant divisor, rounding towards zero
+ *
+ * The magic number of a negative divisor is negated unless the division is
+ * branch free, in which case the quotient is negated at the end.
+ */
+template<typename S>
+struct SignedDivider {
+    using U = MakeUnsigned<S>;
+
+    S            magic;
+    std::uint8_t more;
+
+    static constexpr SignedDivider generate(const S divisor,
+                                            const bool branchfree = false)
+                                            noexcept {
+        const U absolute = (divisor < 0)
+                           ? static_cast<U>(U{} - static_cast<U>(divisor))
+                           : static_cast<U>(divisor);
+        const unsigned floor_log2 = significantBits(absolute) - 1;
+        const std::uint8_t sign = (divisor < 0) ? dividerNegative : 0;
+
+        if ((absolute & (absolute - 1)) == 0) {
+            return {0, static_cast<std::uint8_t>(floor_log2 | sign)};
+        }
+
+        // 2^(N - 1 + floor_log2) / |divisor|, doubled if not exact enough
+        U remainder = 0;
+        U magic = wideQuotient(static_cast<U>(U{1} << (floor_log2 - 1)),
+                               absolute, remainder);
+        std::uint8_t more = static_cast<std::uint8_t>(floor_log2 - 1);
+        if (branchfree || ((absolute - remainder) >= (U{1} << floor_log2))) {
+            const U twice = static_cast<U>(remainder + remainder);
+            magic = static_cast<U>(magic + magic
+                                   + ((twice >= absolute) || (twice < remainder)));
+            more = static_cast<std::uint8_t>(floor_log2 | dividerAdd);
+        }
+        magic = static_cast<U>(magic + 1);
+        if ((divisor < 0) && !branchfree) {
+            magic = static_cast<U>(U{} - magic);
+        }
+        return {static_cast<S>(magic), static_cast<std::uint8_t>(more | sign)};
+    }
+
+    constexpr S divide(const S numerator) const noexcept {
+        const unsigned shift = more & dividerShiftMask;
+        const U sign = (more & dividerNegative) ? ~U{} : U{};
+        if (magic == 0) {
+            // Rounds towards zero by biasing negative numerators
+            const U mask = static_cast<U>((U{1} << shift) - 1);
+            const U biased = static_cast<U>(numerator)
+                             + ((numerator < 0) ? mask : U{});
+            const U quotient = static_cast<U>(static_cast<S>(biased) >> shift);
+            return static_cast<S>((quotient ^ sign) - sign);
+        }
+
+        U quotient = static_cast<U>(mulHigh(magic, numerator));
+        if (more & dividerAdd) {
+            quotient += (static_cast<U>(numerator) ^ sign) - sign;
+        }
+        const S shifted = static_cast<S>(quotient) >> shift;
+        return static_cast<S>(shifted + (shifted < 0));
+    }
+
+};
+
+/*
+ * Branch free division of signed words, the fix-up step is always taken and
+ * powers of two are told apart by their zero magic number arithmetically
+ */
+template<typename S>
+struct SignedBranchfreeDivider {
+    using U = MakeUnsigned<S>;
+
+    S            magic;
+    std::uint8_t more;
+
+    static constexpr SignedBranchfreeDivider generate(const S divisor)
+                                                      noexcept {
+        const SignedDivider<S> parameters = SignedDivider<S>::generate(divisor,
+                                                                       true);
+        return {parameters.magic, parameters.more};
+    }
+
+    constexpr S divide(const S numerator) const noexcept {
+        const unsigned shift = more & dividerShiftMask;
+        const U sign = (more & dividerNegative) ? ~U{} : U{};
+        U quotient = static_cast<U>(mulHigh(magic, numerator))
+                     + static_cast<U>(numerator);
+        // Negative quotients are rounded towards zero by adding 2^shift,
+        // less one for powers of two
+        const U negative = static_cast<U>(static_cast<S>(quotient)
+                                          >> IntegralTraits<S>::digits);
+        quotient += negative & static_cast<U>((U{1} << shift) - (magic == 0));
+        const U shifted = static_cast<U>(static_cast<S>(quotient) >> shift);
+        return static_cast<S>((shifted ^ sign) - sign);
+    }
+};
+
+/*
+ * Division kernel of an Integral<T> divider
+ */
+template<typename T, bool Branchfree>
+using DividerKernel = std::conditional_t<
+    IntegralTraits<T>::is_signed,
+    std::conditional_t<Branchfree, SignedBranchfreeDivider<DividerWord<T>>,
+                                   SignedDivider<DividerWord<T>>>,
+    std::conditional_t<Branchfree, UnsignedBranchfreeDivider<DividerWord<T>>,
+                                   UnsignedDivider<DividerWord<T>>>>;
+
+/*
+ * Word the bit manipulation kernels operate on, narrower types are zero
+ * extended to 32 bits
+ */
+template<typename T>
+using BitWord = std::conditional_t<(sizeof(T) <= 4), std::uint32_t,
+                                                     FixedWidth<T>>;
+
+/*
+ * Number of set bits, a single POPCNT where the target has it
+ */
+constexpr int popCount(const std::uint32_t value) noexcept {
+    return __builtin_popcount(value);
+}
+
+constexpr int popCount(const std::uint64_t value) noexcept {
+    return __builtin_popcountll(value);
+}
+
+/*
+ * Number of consecutive zero bits from the most significant bit, a single
+ * LZCNT where the target has it as the zero check then folds away
+ */
+constexpr int leadingZeros(const std::uint32_t value) noexcept {
+    return value ? __builtin_clz(value) : 32;
+}
+
+constexpr int leadingZeros(const std::uint64_t value) noexcept {
+    return value ? __builtin_clzll(value) : 64;
+}
+
+/*
+ * Number of consecutive zero bits from the least significant bit, a single
+ * TZCNT where the target has it
+ */
+constexpr int trailingZeros(const std::uint32_t value) noexcept {
+    return value ? __builtin_ctz(value) : 32;
+}
+
+constexpr int trailingZeros(const std::uint64_t value) noexcept {
+    return value ? __builtin_ctzll(value) : 64;
+}
+
+/*
+ * Reverses the order of the bytes, a single BSWAP
+ */
+constexpr std::uint32_t byteSwap(const std::uint32_t value) noexcept {
+    return __builtin_bswap32(value);
+}
+
+constexpr std::uint64_t byteSwap(const std::uint64_t value) noexcept {
+    return __builtin_bswap64(value);
+}
+
+/*
+ * Reverses the order of the bits, without a dedicated instruction the bits
+ * of every byte are swapped in three mask and shift steps before the bytes
+ * themselves are swapped
+ */
+constexpr std::uint64_t bitReverse(std::uint64_t value) noexcept {
+#if defined(INTEGRAL_CSP_BITREVERSE)
+    return __builtin_bitreverse64(value);
+#else
+    value = ((value >> 1) & 0x5555555555555555ULL) | ((value & 0x5555555555555555ULL) << 1);
+    value = ((value >> 2) & 0x3333333333333333ULL) | ((value & 0x3333333333333333ULL) << 2);
+    value = ((value >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((value & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    return __builtin_bswap64(value);
+#endif
+}
+
+constexpr std::uint32_t bitReverse(const std::uint32_t value) noexcept {
+    return static_cast<std::uint32_t>(bitReverse(std::uint64_t{value}) >> 32);
+}
+
+#if defined(__SIZEOF_INT128__)
+/*
+ * 128-bit counterparts, composed from the kernels of the two halves
+ */
+constexpr int popCount(const UInt128 value) noexcept {
+    return popCount(static_cast<std::uint64_t>(value >> 64))
+           + popCount(static_cast<std::uint64_t>(value));
+}
+
+constexpr int leadingZeros(const UInt128 value) noexcept {
+    return (value >> 64)
+           ? leadingZeros(static_cast<std::uint64_t>(value >> 64))
+           : 64 + leadingZeros(static_cast<std::uint64_t>(value));
+}
+
+constexpr int trailingZeros(const UInt128 value) noexcept {
+    return static_cast<std::uint64_t>(value)
+           ? trailingZeros(static_cast<std::uint64_t>(value))
+           : 64 + trailingZeros(static_cast<std::uint64_t>(value >> 64));
+}
+
+constexpr UInt128 byteSwap(const UInt128 value) noexcept {
+    return (static_cast<UInt128>(byteSwap(static_cast<std::uint64_t>(value))) << 64)
+           | byteSwap(static_cast<std::uint64_t>(value >> 64));
+}
+
+constexpr UInt128 bitReverse(const UInt128 value) noexcept {
+    return (static_cast<UInt128>(bitReverse(static_cast<std::uint64_t>(value))) << 64)
+           | bitReverse(static_cast<std::uint64_t>(value >> 64));
+}
+#endif
+
+/*
+ * Scatters the low order bits of value to the positions of the set bits of
+ * mask, lowest first, one mask bit per step
+ */
+constexpr std::uint64_t depositBitsPortable(const std::uint64_t value,
+                                            std::uint64_t mask) noexcept {
+    std::uint64_t result = 0;
+    for (std::uint64_t bit = 1; mask != 0; bit <<= 1) {
+        if (value & bit) {
+            result |= mask & (0u - mask);
+        }
+        mask &= mask - 1u;
+    }
+    return result;
+}
+
+/*
+ * Gathers the bits of value at the positions of the set bits of mask into
+ * the low order bits of the result, one mask bit per step
+ */
+constexpr std::uint64_t extractBitsPortable(const std::uint64_t value,
+                                            std::uint64_t mask) noexcept {
+    std::uint64_t result = 0;
+    for (std::uint64_t bit = 1; mask != 0; bit <<= 1) {
+        if (value & mask & (0u - mask)) {
+            result |= bit;
+        }
+        mask &= mask - 1u;
+    }
+    return result;
+}
+
+#if defined(INTEGRAL_CSP_X86)
+__attribute__((target("bmi2")))
+inline std::uint64_t depositBitsPdep(const std::uint64_t value,
+                                     const std::uint64_t mask) noexcept {
+    return _pdep_u64(value, mask);
+}
+
+__attribute__((target("bmi2")))
+inline std::uint64_t extractBitsPext(const std::uint64_t value,
+                                     const std::uint64_t mask) noexcept {
+    return _pext_u64(value, mask);
+}
+#endif
+
+/*
+ * Bit deposit and extraction, a single PDEP or PEXT on processors where they
+ * are not microcoded
+ */
+constexpr std::uint64_t depositBits(const std::uint64_t value,
+                                    const std::uint64_t mask) noexcept {
+#if defined(INTEGRAL_CSP_X86)
+    if (!INTEGRAL_CSP_CONSTANT_EVALUATED() && cpuFeatures().fast_bmi2) {
+        return depositBitsPdep(value, mask);
+    }
+#endif
+    return depositBitsPortable(value, mask);
+}
+
+constexpr std::uint64_t extractBits(const std::uint64_t value,
+                                    const std::uint64_t mask) noexcept {
+#if defined(INTEGRAL_CSP_X86)
+    if (!INTEGRAL_CSP_CONSTANT_EVALUATED() && cpuFeatures().fast_bmi2) {
+        return extractBitsPext(value, mask);
+    }
+#endif
+    return extractBitsPortable(value, mask);
+}
+
+/*
+ * Bits of a Morton key that belong to the first axis, the axes that follow
+ * are the same bits shifted by one position per axis
+ */
+template<std::size_t Dimensions>
+constexpr std::uint64_t mortonMask =
+    (Dimensions == 2) ? 0x5555555555555555ULL : 0x1249249249249249ULL;
+
+/*
+ * Spreads the bits of a coordinate to every Dimensions-th bit of the key
+ * with the "magic bits" sequence: each step moves the upper half of every
+ * group away from its lower half and masks off what does not belong
+ */
+constexpr std::uint64_t spreadBits(const std::uint32_t coordinate,
+                                   std::integral_constant<std::size_t, 2>)
+                                   noexcept {
+    std::uint64_t bits = coordinate;
+    bits = (bits | (bits << 16)) & 0x0000FFFF0000FFFFULL;
+    bits = (bits | (bits << 8))  & 0x00FF00FF00FF00FFULL;
+    bits = (bits | (bits << 4))  & 0x0F0F0F0F0F0F0F0FULL;
+    bits = (bits | (bits << 2))  & 0x3333333333333333ULL;
+    bits = (bits | (bits << 1))  & 0x5555555555555555ULL;
+    return bits;
+}
+
+constexpr std::uint64_t spreadBits(const std::uint32_t coordinate,
+                                   std::integral_constant<std::size_t, 3>)
+                                   noexcept {
+    std::uint64_t bits = coordinate & 0x1FFFFFu;
+    bits = (bits | (bits << 32)) & 0x001F00000000FFFFULL;
+    bits = (bits | (bits << 16)) & 0x001F0000FF0000FFULL;
+    bits = (bits | (bits << 8))  & 0x100F00F00F00F00FULL;
+    bits = (bits | (bits << 4))  & 0x10C30C30C30C30C3ULL;
+    bits = (bits | (bits << 2))  & 0x1249249249249249ULL;
+    return bits;
+}
+
+/*
+ * Inverse of spreadBits, the same steps in reverse order
+ */
+constexpr std::uint32_t compactBits(std::uint64_t bits,
+                                    std::integral_constant<std::size_t, 2>)
+                                    noexcept {
+    bits &= 0x5555555555555555ULL;
+    bits = (bits | (bits >> 1))  & 0x3333333333333333ULL;
+    bits = (bits | (bits >> 2))  & 0x0F0F0F0F0F0F0F0FULL;
+    bits = (bits | (bits >> 4))  & 0x00FF00FF00FF00FFULL;
+    bits = (bits | (bits >> 8))  & 0x0000FFFF0000FFFFULL;
+    bits = (bits | (bits >> 16)) & 0x00000000FFFFFFFFULL;
+    return static_cast<std::uint32_t>(bits);
+}
+
+constexpr std::uint32_t compactBits(std::uint64_t bits,
+                                    std::integral_constant<std::size_t, 3>)
+                                    noexcept {
+    bits &= 0x1249249249249249ULL;
+    bits = (bits | (bits >> 2))  & 0x10C30C30C30C30C3ULL;
+    bits = (bits | (bits >> 4))  & 0x100F00F00F00F00FULL;
+    bits = (bits | (bits >> 8))  & 0x001F0000FF0000FFULL;
+    bits = (bits | (bits >> 16)) & 0x001F00000000FFFFULL;
+    bits = (bits | (bits >> 32)) & 0x00000000001FFFFFULL;
+    return static_cast<std::uint32_t>(bits);
+}
+
+/*
+ * Interleaves the coordinates into a Morton key, one PDEP per axis where it
+ * is fast and the magic bits sequence otherwise
+ */
+template<std::size_t Dimensions>
+constexpr std::uint64_t mortonEncode(const std::uint32_t (&coordinates)[Dimensions])
+                                     noexcept {
+    constexpr std::integral_constant<std::size_t, Dimensions> dimensions{};
+
+    std::uint64_t key = 0;
+#if defined(INTEGRAL_CSP_X86)
+    if (!INTEGRAL_CSP_CONSTANT_EVALUATED() && cpuFeatures().fast_bmi2) {
+        for (std::size_t axis = 0; axis < Dimensions; ++axis) {
+            key |= depositBitsPdep(coordinates[axis],
+                                   mortonMask<Dimensions> << axis);
+        }
+        return key;
+    }
+#endif
+    for (std::size_t axis = 0; axis < Dimensions; ++axis) {
+        key |= spreadBits(coordinates[axis], dimensions) << axis;
+    }
+    return key;
+}
+
+/*
+ * Coordinate of the specified axis held by a Morton key
+ */
+template<std::size_t Dimensions>
+constexpr std::uint32_t mortonDecode(const std::uint64_t key,
+                                     const std::size_t axis) noexcept {
+#if defined(INTEGRAL_CSP_X86)
+    if (!INTEGRAL_CSP_CONSTANT_EVALUATED() && cpuFeatures().fast_bmi2) {
+        return static_cast<std::uint32_t>(
+            extractBitsPext(key, mortonMask<Dimensions> << axis));
+    }
+#endif
+    return compactBits(key >> axis,
+                       std::integral_constant<std::size_t, Dimensions>{});
+}
+
+/*
+ * Floor of the square root of a value
+ *
+ * At runtime the hardware square root of the nearest double is off by at
+ * most one for 64-bit values and is corrected with one comparison each way.
+ * 128-bit values and constant evaluation compute one bit of the root per
+ * step instead.
+ */
+template<typename U>
+constexpr U squareRoot(const U value) noexcept {
+    constexpr U largest = static_cast<U>(
+        (U{1} << (IntegralTraits<U>::digits / 2)) - 1u);
+
+    if (!INTEGRAL_CSP_CONSTANT_EVALUATED() && (sizeof(U) <= sizeof(std::uint64_t))) {
+        U root = static_cast<U>(__builtin_sqrt(static_cast<double>(value)));
+        root = (root > largest) ? largest : root;
+        if (static_cast<U>(root * root) > value) {
+            --root;
+        } else if ((root < largest) && (static_cast<U>((root + 1u) * (root + 1u)) <= value)) {
+            ++root;
+        }
+        return root;
+    }
+
+    U remainder = value;
+    U root      = 0;
+    U bit       = static_cast<U>(U{1} << (IntegralTraits<U>::digits - 2));
+    while (bit > value) {
+        bit = static_cast<U>(bit >> 2);
+    }
+    while (bit != 0) {
+        if (remainder >= static_cast<U>(root + bit)) {
+            remainder = static_cast<U>(remainder - (root + bit));
+            root      = static_cast<U>((root >> 1) + bit);
+        } else {
+            root = static_cast<U>(root >> 1);
+        }
+        bit = static_cast<U>(bit >> 2);
+    }
+    return root;
+}
+
+/*
+ * Exponentiation by squaring, a square that overflows only matters if it is
+ * multiplied into the result later on
+ */
+template<typename T>
+constexpr ArithmeticResult<T> powOverflow(T base,
+                                          unsigned long long exponent)
+                                          noexcept {
+    ArithmeticResult<T> result{T{1}, false, (isNegative(base) && (exponent & 1u))
+                                            ? IntegralTraits<T>::min()
+                                            : IntegralTraits<T>::max()};
+    bool squared_overflow = false;
+    while (exponent != 0) {
+        if (exponent & 1u) {
+            result.overflow |= squared_overflow;
+            result.overflow |= __builtin_mul_overflow(result.wrapped, base,
+                                                      &result.wrapped);
+        }
+        exponent >>= 1;
+        if (exponent != 0) {
+            squared_overflow |= __builtin_mul_overflow(base, base, &base);
+        }
+    }
+    return result;
+}
+
+/*
+ * Greatest common divisor with Stein's binary algorithm: the common power of
+ * two is counted once, then the larger of the two odd operands is replaced
+ * by their difference stripped of its trailing zeros until they meet. The
+ * difference and the minimum are selected without branches, whose outcome
+ * is as good as random
+ */
+template<typename U>
+constexpr U binaryGcd(U lhs, U rhs) noexcept {
+    if ((lhs == 0) || (rhs == 0)) {
+        return static_cast<U>(lhs | rhs);
+    }
+
+    const int shift = trailingZeros(static_cast<BitWord<U>>(lhs | rhs));
+    lhs = static_cast<U>(lhs >> trailingZeros(static_cast<BitWord<U>>(lhs)));
+    rhs = static_cast<U>(rhs >> trailingZeros(static_cast<BitWord<U>>(rhs)));
+    while (lhs != rhs) {
+        const U difference = static_cast<U>((lhs > rhs) ? lhs - rhs : rhs - lhs);
+        rhs = (lhs < rhs) ? lhs : rhs;
+        lhs = static_cast<U>(difference >> trailingZeros(static_cast<BitWord<U>>(difference)));
+    }
+    return static_cast<U>(lhs << shift);
+}
+
+/*
+ * Magnitude of a value as its unsigned counterpart, which holds the
+ * magnitude of the minimum of a signed type
+ */
+template<typename T>
+constexpr MakeUnsigned<T> magnitude(const T value) noexcept {
+    return isNegative(value)
+           ? static_cast<MakeUnsigned<T>>(MakeUnsigned<T>{} - static_cast<MakeUnsigned<T>>(value))
+           : static_cast<MakeUnsigned<T>>(value);
+}
+
+/*
+ * Parameter type of the comparisons of an Ordering with zero, which only the
+ * literal 0 converts to as it is a null pointer constant
+ */
+struct ZeroLiteral {
+    constexpr ZeroLiteral(int ZeroLiteral::*) noexcept {}
+};
+
+} //< namespace detail
+
+/**
+ * @brief Outcome of a three-way comparison of two values of T, in the
+ *        spirit of the comparison categories of operator <=>
+ *
+ * The operands are kept and every comparison of the outcome with the
+ * literal 0 is carried out on them directly, so compare(a, b) < 0 costs a
+ * single compare of a and b rather than the compares that materialize a
+ * sign first.
+ */
+template<typename T>
+class Ordering final {
+
+public:
+
+    /**
+     * @brief Constructor to initialize the comparison
+     *
+     * @param lhs Left hand operand
+     * @param rhs Right hand operand
+     */
+    constexpr Ordering(const T lhs, const T rhs) noexcept
+    : m_lhs{lhs}, m_rhs{rhs} {}
+
+    /**
+     * @brief Get the sign of the comparison
+     *
+     * @return -1 if lhs is less than rhs, 1 if it is greater, 0 otherwise
+     */
+    constexpr int value() const noexcept {
+        return static_cast<int>(m_lhs > m_rhs) - static_cast<int>(m_lhs < m_rhs);
+    }
+
+    friend constexpr bool operator ==(const Ordering ordering,
+                                      detail::ZeroLiteral) noexcept {
+        return ordering.m_lhs == ordering.m_rhs;
+    }
+
+    friend constexpr bool operator !=(const Ordering ordering,
+                                      detail::ZeroLiteral) noexcept {
+        return ordering.m_lhs != ordering.m_rhs;
+    }
+
+    friend constexpr bool operator <(const Ordering ordering,
+                                     detail::ZeroLiteral) noexcept {
+        return ordering.m_lhs < ordering.m_rhs;
+    }
+
+    friend constexpr bool operator >(const Ordering ordering,
+                                     detail::ZeroLiteral) noexcept {
+        return ordering.m_lhs > ordering.m_rhs;
+    }
+
+    friend constexpr bool operator <=(const Ordering ordering,
+                                      detail::ZeroLiteral) noexcept {
+        return ordering.m_lhs <= ordering.m_rhs;
+    }
+
+    friend constexpr bool operator >=(const Ordering ordering,
+                                      detail::ZeroLiteral) noexcept {
+        return ordering.m_lhs >= ordering.m_rhs;
+    }
+
+private:
+    T m_lhs; //< Left hand operand
+    T m_rhs; //< Right hand operand
+
+}; //< Ordering<T>
+
+/**
+ * @brief Result of an arithmetic operation that may not fit its type,
+ *        produced by objects using the overflow::Checked policy
+ *
+ * Holds the wrapped result together with a flag telling whether the exact
+ * result did not fit, in the spirit of an expected value.
+ */
+template<typename I>
+class CheckedResult final {
+
+public:
+
+    /**
+     * @brief Constructor to initialize the result
+     *
+     * @param value    Result wrapped modulo 2^N
+     * @param overflow Whether the exact result did not fit
+     */
+    constexpr CheckedResult(const I value, const bool overflow) noexcept
+    : m_value{value}, m_overflow{overflow} {}
+
+    /**
+     * @brief Whether the exact result fits the type
+     */
+    constexpr bool has_value() const noexcept {
+        return !m_overflow;
+    }
+
+    /**
+     * @brief Whether the exact result fits the type
+     */
+    constexpr explicit operator bool() const noexcept {
+        return !m_overflow;
+    }
+
+    /**
+     * @brief Whether the exact result did not fit the type
+     */
+    constexpr bool overflow() const noexcept {
+        return m_overflow;
+    }
+
+    /**
+     * @brief Get the exact result
+     *
+     * @throws std::overflow_error If the exact result did not fit the type
+     *
+     * @return The exact result
+     */
+    constexpr I value() const {
+        if (m_overflow) {
+            throw std::overflow_error{"compuSUAVE_Professional::Integral: "
+                                      "arithmetic overflow"};
+        }
+        return m_value;
+    }
+
+    /**
+     * @brief Get the exact result or the specified fallback on overflow
+     *
+     * @param fallback Value to return if the exact result did not fit
+     *
+     * @return The exact result or the fallback
+     */
+    constexpr I value_or(const I fallback) const noexcept {
+        return m_overflow ? fallback : m_value;
+    }
+
+    /**
+     * @brief Get the result wrapped modulo 2^N, whether it overflowed or not
+     *
+     * @return The wrapped result
+     */
+    constexpr I wrapped() const noexcept {
+        return m_value;
+    }
+
+private:
+    I    m_value;    //< Wrapped result
+    bool m_overflow; //< Exact result did not fit
+
+}; //< CheckedResult<I>
+
+/**
+ * @brief Policies deciding what the arithmetic operators of Integral<T>
+ *        do with a result that does not fit T
+ *
+ * Overflow is detected with the __builtin_*_overflow intrinsics, so every
+ * policy costs at most a test of the flag the operation already produced.
+ * Division by zero is reported as overflow by the policies whose
+ * checks_divisor is true; for the others the divisor must not be zero.
+ */
+namespace overflow {
+
+/**
+ * @brief Results wrap around modulo 2^N, for signed types as well
+ *
+ * - Default policy, matching the behaviour of unsigned fundamental types
+ *   without the undefined behaviour of signed ones
+ */
+struct Wrapping final {
+    template<typename I>
+    using result_type = I;
+
+    // A zero divisor is a precondition, as for the fundamental types
+    static constexpr bool checks_divisor = false;
+
+    template<typename I, typename T>
+    static constexpr I resolve(const detail::ArithmeticResult<T>& result)
+                               noexcept {
+        return I{result.wrapped};
+    }
+};
+
+/**
+ * @brief Results are clamped to the nearest representable value
+ */
+struct Saturating final {
+    template<typename I>
+    using result_type = I;
+
+    static constexpr bool checks_divisor = true;
+
+    template<typename I, typename T>
+    static constexpr I resolve(const detail::ArithmeticResult<T>& result)
+                               noexcept {
+        return I{result.overflow ? result.bound : result.wrapped};
+    }
+};
+
+/**
+ * @brief Results are handed out as CheckedResult carrying the overflow flag
+ */
+struct Checked final {
+    template<typename I>
+    using result_type = CheckedResult<I>;
+
+    static constexpr bool checks_divisor = true;
+
+    template<typename I, typename T>
+    static constexpr CheckedResult<I> resolve(
+        const detail::ArithmeticResult<T>& result) noexcept {
+        return CheckedResult<I>{I{result.wrapped}, result.overflow};
+    }
+};
+
+/**
+ * @brief Execution is aborted with a trap instruction on overflow, and
+ *        overflow in a constant expression fails to compile
+ */
+struct Trapping final {
+    template<typename I>
+    using result_type = I;
+
+    static constexpr bool checks_divisor = true;
+
+    template<typename I, typename T>
+    static constexpr I resolve(const detail::ArithmeticResult<T>& result)
+                               noexcept {
+        if (result.overflow) {
+            __builtin_trap();
+        }
+        return I{result.wrapped};
+    }
+};
+
+} //< namespace overflow
+
 /**
  * @brief This component is a wrapper to any fundamental integral type.
  *        It consists of all attributes and operations well known for such a
  *        type including extra operations such as conversions to string
  *        representations of various numerical bases and a few others.
+ *
+ * The Policy decides what arithmetic does with results that do not fit T,
+ * one of overflow::Wrapping (default), overflow::Saturating,
+ * overflow::Checked or overflow::Trapping.
  */
-template<typename T>
+template<typename T, typename Policy = overflow::Wrapping>
 class Integral final {
 
     /*
      * Assert that instantiation was done with a type parameter that contain
      * integral type traits.
      */
-    static_assert(std::is_integral<T>::value,
+    static_assert(detail::IntegralTraits<T>::integral,
                   "Error instantiating compuSUAVE_Professional::Integral<T>:\
                    Found non-integral type");
 
@@ -62,6 +2476,24 @@ public:
      */
     using value_type = T;
 
+    /**
+     * @brief Inline string type large enough to hold the representation of
+     *        any value in any radix, sign included
+     */
+    using string_type =
+        FixedString<detail::IntegralTraits<detail::MakeUnsigned<T>>::digits + 1>;
+
+    /**
+     * @brief Overflow policy of the arithmetic operations
+     */
+    using policy_type = Policy;
+
+    /**
+     * @brief Type produced by the arithmetic operations, the object type
+     *        itself or CheckedResult for the overflow::Checked policy
+     */
+    using result_type = typename Policy::template result_type<Integral>;
+
     //=========================================================================
     // Constructors
     //=========================================================================
@@ -85,10 +2517,9 @@ public:
     /**
      * @brief Copy constructor
      *
-     * @param carbon_copy Object to copy value from
+     * Defaulted so that objects are trivially copyable as T is
      */
-    constexpr Integral(const Integral<T>& carbon_copy) noexcept
-    : m_value{carbon_copy} {}
+    constexpr Integral(const Integral&) noexcept = default;
 
     /**
      * @brief Constructor to initialize the object with the specified value
@@ -102,10 +2533,9 @@ public:
     /**
      * @brief Move constructor to transfer the value from the specified object
      *
-     * @param carbon_copy Object to transfer the value from
+     * Defaulted so that objects are trivially copyable as T is
      */
-    constexpr Integral(Integral<T>&& carbon_copy) noexcept
-    : m_value{carbon_copy} {}
+    constexpr Integral(Integral&&) noexcept = default;
 
     /**
      * @brief Constructor to initialize the object with a C-String
@@ -117,7 +2547,7 @@ public:
      * @param value C-String to parse
      */
     constexpr Integral(const char* value) noexcept
-    : Integral{std::string{value}} {}
+    : Integral{parse(value, value + detail::length(value))} {}
 
     /**
      * @brief Constructor to initialize the object with a std::string object
@@ -129,35 +2559,7 @@ public:
      * @param value std::string object to parse
      */
     Integral(const std::string& value) noexcept
-    : m_value{T{}} {
-
-        // Check for binary sequence
-        if ((value.find("0b") == 0) || (value.find("0B") == 0)) {
-            try {
-                std::bitset<std::numeric_limits<T>::digits> bits{value, 2};
-                m_value = static_cast<T>(bits.to_ullong());
-            } catch(const std::invalid_argument& ia) {}
-            return;
-        }
-
-        std::stringstream converter{value};
-
-        // Check for hexidecimal sequence
-        if (value.find("0x") == 0) {
-            converter << std::hex;
-            converter >> m_value;
-            return;
-        }
-
-        // Check for octal sequence
-        if (value.find("0") == 0) {
-            converter << std::oct;
-            converter >> m_value;
-            return;
-        }
-
-        converter >> m_value;       
-    }
+    : Integral{parse(value.data(), value.data() + value.size())} {}
 
     //=========================================================================
     // Assignment Operations
@@ -166,26 +2568,21 @@ public:
     /**
      * @brief Assigns the value from the specified object
      *
-     * @param carbon_copy Object to get the value from
+     * Defaulted so that objects are trivially copyable as T is, which lets
+     * containers and algorithms copy them with memmove
      *
      * @return Transformed object containing a new value
      */
-    constexpr Integral<T>&
-    operator =(const Integral<T>& carbon_copy) noexcept {
-        return checkAndAssign(carbon_copy);
-    }
+    constexpr Integral& operator =(const Integral&) noexcept = default;
 
     /**
      * @brief Assigns the value from the specified temporary object
      *
-     * @param carbon_copy Object to get the value from
+     * Defaulted so that objects are trivially copyable as T is
      *
      * @return Transformed object containing a new value
      */
-    constexpr Integral<T>&
-    operator =(Integral<T>&& carbon_copy) noexcept {
-        return checkAndAssign(carbon_copy);
-    }
+    constexpr Integral& operator =(Integral&&) noexcept = default;
 
     /**
      * @brief Assigns the value from the specified compatible type
@@ -195,9 +2592,9 @@ public:
      * @return Transformed object containing a new value
      */
     template<typename CompatibleType>
-    constexpr Integral<T>&
+    constexpr Integral&
     operator =(const CompatibleType ct) noexcept {
-        return checkAndAssign(Integral<T>{ct});
+        return *this = Integral{ct};
     }
 
     //=========================================================================
@@ -205,7 +2602,7 @@ public:
     //=========================================================================
 
     /**
-     * @brief Default constructor
+     * @brief Destructor
      */
     ~Integral() = default;
 
@@ -219,12 +2616,13 @@ public:
      * @param lhs Left hand operand
      * @param rhs Right hand operand
      *
-     * @return Result from the operation
+     * @return Result from the operation, overflow handled as Policy
+     *         dictates
      */
-    friend constexpr Integral<T> operator +(const Integral<T>& lhs,
-                                            const Integral<T>& rhs)
-                                            noexcept {
-        return Integral<T>{lhs.m_value + rhs.m_value};
+    friend constexpr result_type operator +(const Integral& lhs,
+                                             const Integral& rhs) noexcept {
+        return Policy::template resolve<Integral>(
+            detail::addOverflow(lhs.m_value, rhs.m_value));
     }
 
     //=========================================================================
@@ -238,9 +2636,8 @@ public:
      *
      * @return The incremented value
      */
-    constexpr Integral<T>& operator ++() noexcept {
-        ++m_value;
-        return *this;
+    constexpr Integral& operator ++() noexcept {
+        return *this = step(detail::addOverflow(m_value, T{1}));
     }
 
     /**
@@ -250,8 +2647,10 @@ public:
      *
      * @return The pre-incremented value
      */
-    constexpr Integral<T> operator ++(int) noexcept {
-        return Integral<T>{m_value++};
+    constexpr Integral operator ++(int) noexcept {
+        const Integral previous{*this};
+        ++*this;
+        return previous;
     }
 
     //=========================================================================
@@ -264,12 +2663,13 @@ public:
      * @param lhs Left hand operand
      * @param rhs Right hand operand
      *
-     * @return Result from the operation
+     * @return Result from the operation, overflow handled as Policy
+     *         dictates
      */
-    friend constexpr Integral<T> operator -(const Integral<T>& lhs,
-                                            const Integral<T>& rhs)
-                                            noexcept {
-        return Integral<T>{lhs.m_value - rhs.m_value};
+    friend constexpr result_type operator -(const Integral& lhs,
+                                             const Integral& rhs) noexcept {
+        return Policy::template resolve<Integral>(
+            detail::subOverflow(lhs.m_value, rhs.m_value));
     }
 
     //=========================================================================
@@ -283,9 +2683,8 @@ public:
      *
      * @return The decremented value
      */
-    constexpr Integral<T>& operator --() noexcept {
-        --m_value;
-        return *this;
+    constexpr Integral& operator --() noexcept {
+        return *this = step(detail::subOverflow(m_value, T{1}));
     }
 
     /**
@@ -295,8 +2694,10 @@ public:
      *
      * @return The pre-decremented value
      */
-    constexpr Integral<T> operator --(int) noexcept {
-        return Integral<T>{m_value--};
+    constexpr Integral operator --(int) noexcept {
+        const Integral previous{*this};
+        --*this;
+        return previous;
     }
 
     //=========================================================================
@@ -308,10 +2709,11 @@ public:
      *
      * - value and object is synonymous in this context
      *
-     * @return Value with opposite sign
+     * @return Value with opposite sign, overflow handled as Policy dictates
      */
-    constexpr Integral<T> operator -() const noexcept {
-        return -m_value;
+    constexpr result_type operator -() const noexcept {
+        return Policy::template resolve<Integral>(
+            detail::subOverflow(T{}, m_value));
     }
 
     //=========================================================================
@@ -324,12 +2726,62 @@ public:
      * @param lhs Left hand operand
      * @param rhs Right hand operand
      *
-     * @return Result from the operation
+     * @return Result from the operation, overflow handled as Policy
+     *         dictates
      */
-    friend constexpr Integral<T> operator *(const Integral<T>& lhs,
-                                            const Integral<T>& rhs)
-                                            noexcept {
-        return Integral<T>{lhs.m_value * rhs.m_value};
+    friend constexpr result_type operator *(const Integral& lhs,
+                                             const Integral& rhs) noexcept {
+        return Policy::template resolve<Integral>(
+            detail::mulOverflow(lhs.m_value, rhs.m_value));
+    }
+
+    //=========================================================================
+    // Widening Multiplication
+    //=========================================================================
+
+    /**
+     * @brief Performs multiplication on the specified objects keeping every
+     *        bit of the product
+     *
+     * Available for types up to 64 bits, whose product fits the integral
+     * type of twice their width, 128 bits for the 64-bit types
+     *
+     * @param lhs Left hand operand
+     * @param rhs Right hand operand
+     *
+     * @return Full product of the operands, which never overflows
+     */
+    friend constexpr Integral<detail::Widened<T>, Policy>
+    mul_wide(const Integral& lhs, const Integral& rhs) noexcept {
+        using Wide = detail::Widened<T>;
+        static_assert(sizeof(Wide) > sizeof(T),
+                      "No integral type is wide enough for the product");
+
+        return Integral<Wide, Policy>{
+            static_cast<Wide>(static_cast<Wide>(lhs.m_value)
+                              * static_cast<Wide>(rhs.m_value))};
+    }
+
+    /**
+     * @brief Performs multiplication on the specified objects keeping the
+     *        high half of the product
+     *
+     * Complements operator * of the wrapping policy, which yields the low
+     * half, for types up to 64 bits
+     *
+     * @param lhs Left hand operand
+     * @param rhs Right hand operand
+     *
+     * @return Upper sizeof(T) bytes of the full product of the operands
+     */
+    friend constexpr Integral mulhi(const Integral& lhs,
+                                    const Integral& rhs) noexcept {
+        using Wide = detail::Widened<T>;
+        static_assert(sizeof(Wide) > sizeof(T),
+                      "No integral type is wide enough for the product");
+
+        return Integral{static_cast<T>(detail::mulHigh(lhs.m_value,
+                                                        rhs.m_value))};
     }
 
     //=========================================================================
@@ -342,12 +2794,15 @@ public:
      * @param lhs Left hand operand
      * @param rhs Right hand operand
      *
-     * @return Result from the operation
+     * @return Result from the operation, overflow handled as Policy
+     *         dictates
      */
-    friend constexpr Integral<T> operator /(const Integral<T>& lhs,
-                                            const Integral<T>& rhs)
-                                            noexcept {
-        return Integral<T>{lhs.m_value / rhs.m_value};
+    friend constexpr result_type operator /(const Integral& lhs,
+                                             const Integral& rhs) noexcept {
+        return Policy::template resolve<Integral>(
+            detail::divOverflow(lhs.m_value, rhs.m_value,
+                                std::integral_constant<bool,
+                                    Policy::checks_divisor>{}));
     }
 
     //=========================================================================
@@ -360,18 +2815,182 @@ public:
      * @param lhs Left hand operand
      * @param rhs Right hand operand
      *
-     * @return Result from the operation
+     * @return Result from the operation, overflow handled as Policy
+     *         dictates
      */
-    friend constexpr Integral<T> operator %(const Integral<T>& lhs,
-                                            const Integral<T>& rhs)
-                                            noexcept {
-        return Integral<T>{lhs.m_value % rhs.m_value};
+    friend constexpr result_type operator %(const Integral& lhs,
+                                             const Integral& rhs) noexcept {
+        return Policy::template resolve<Integral>(
+            detail::modOverflow(lhs.m_value, rhs.m_value,
+                                std::integral_constant<bool,
+                                    Policy::checks_divisor>{}));
     }
 
+    //=========================================================================
+    // Division by Invariant Divisors
+    //=========================================================================
+
+    /**
+     * @brief Precomputed division by a divisor known only at runtime
+     *
+     * Replaces the hardware division of operator / and operator % by a
+     * multiplication keeping the high half of the product and shifts, which
+     * pays off as soon as many values are divided by the same divisor.
+     * Results and overflow handling are those of the plain operators.
+     *
+     * @tparam Branchfree Whether every divisor follows the same instruction
+     *                    sequence, trading a few instructions for the
+     *                    absence of branches as needed for vectorization
+     */
+    template<bool Branchfree>
+    class invariant_divider final {
+
+        static_assert(sizeof(T) <= sizeof(std::uint64_t),
+                      "Invariant dividers are limited to 64-bit types");
+
+    public:
+
+        /**
+         * @brief Constructor to precompute the division by the specified
+         *        divisor
+         *
+         * @param divisor Divisor of every subsequent division
+         *
+         * @throws std::invalid_argument If the divisor is zero
+         */
+        constexpr invariant_divider(const Integral divisor)
+        : m_kernel{Kernel::generate(checkDivisor(divisor.m_value))},
+          m_divisor{divisor.m_value} {}
+
+        /**
+         * @brief Get the divisor
+         *
+         * @return Divisor of every division
+         */
+        constexpr Integral divisor() const noexcept {
+            return Integral{m_divisor};
+        }
+
+        /**
+         * @brief Divides the specified number of objects, output may alias
+         *        the input
+         *
+         * @param first Objects to divide
+         * @param count Number of objects
+         * @param out   Destination of the quotients
+         */
+        void divide(const Integral* first, const std::size_t count,
+                    Integral* out) const noexcept {
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i].m_value = quotient(first[i].m_value).wrapped;
+            }
+        }
+
+        /**
+         * @brief Performs division by the precomputed divisor
+         *
+         * @param lhs Left hand operand
+         * @param rhs Precomputed divisor
+         *
+         * @return Result from the operation, overflow handled as Policy
+         *         dictates
+         */
+        friend constexpr result_type operator /(const Integral& lhs,
+                                                 const invariant_divider& rhs)
+                                                 noexcept {
+            return Policy::template resolve<Integral>(
+                rhs.quotient(static_cast<T>(lhs)));
+        }
+
+        /**
+         * @brief Performs modulo by the precomputed divisor
+         *
+         * @param lhs Left hand operand
+         * @param rhs Precomputed divisor
+         *
+         * @return Result from the operation
+         */
+        friend constexpr result_type operator %(const Integral& lhs,
+                                                 const invariant_divider& rhs)
+                                                 noexcept {
+            using UnsignedWord = detail::MakeUnsigned<Word>;
+
+            const T numerator = static_cast<T>(lhs);
+            const T quotient  = rhs.quotient(numerator).wrapped;
+            const T remainder = static_cast<T>(static_cast<Word>(
+                static_cast<UnsignedWord>(numerator)
+                - static_cast<UnsignedWord>(quotient)
+                  * static_cast<UnsignedWord>(rhs.m_divisor)));
+            return Policy::template resolve<Integral>(
+                detail::ArithmeticResult<T>{remainder, false, T{}});
+        }
+
+    private:
+        using Word   = detail::DividerWord<T>;
+        using Kernel = detail::DividerKernel<T, Branchfree>;
+
+        /*
+         * Division Helper Method, only the minimum of a signed type divided
+         * by minus one overflows
+         */
+        constexpr detail::ArithmeticResult<T> quotient(const T numerator)
+                                                       const noexcept {
+            return {static_cast<T>(m_kernel.divide(static_cast<Word>(numerator))),
+                    detail::IntegralTraits<T>::is_signed
+                    && (numerator == detail::IntegralTraits<T>::min())
+                    && (m_divisor == static_cast<T>(-1)),
+                    detail::IntegralTraits<T>::max()};
+        }
+
+        /*
+         * Constructor Helper Method
+         */
+        static constexpr Word checkDivisor(const T divisor) {
+            if (divisor == T{}) {
+                throw std::invalid_argument{"compuSUAVE_Professional::Integral: "
+                                            "division by zero"};
+            }
+            return static_cast<Word>(divisor);
+        }
+
+        Kernel m_kernel;  //< Magic number and shifts
+        T      m_divisor; //< Divisor the kernel was generated for
+
+    }; //< invariant_divider<Branchfree>
+
+    /**
+     * @brief Precomputed division by a runtime divisor, powers of two and
+     *        divisors whose magic number fits T take shorter paths
+     */
+    using divider = invariant_divider<false>;
+
+    /**
+     * @brief Precomputed division by a runtime divisor without branches,
+     *        suited to loops the compiler vectorizes
+     */
+    using branchfree_divider = invariant_divider<true>;
+
     //=========================================================================
     // Comparison Operations
     //=========================================================================
 
+    /**
+     * @brief Performs a three-way comparison of the specified objects, the
+     *        primitive every relational operator derives from
+     *
+     * Compare the outcome with the literal 0 to get the relation of the
+     * operands, e.g. compare(lhs, rhs) <= 0, or call value() for its sign
+     *
+     * @param lhs Left hand operand
+     * @param rhs Right hand operand
+     *
+     * @return Outcome of the comparison
+     */
+    friend constexpr Ordering<T> compare(const Integral& lhs,
+                                         const Integral& rhs) noexcept {
+        return Ordering<T>{lhs.m_value, rhs.m_value};
+    }
+
     /**
      * @brief Determines if the objects are of equal value
      *
@@ -380,10 +2999,10 @@ public:
      *
      * @return True if equal, false otherwise
      */
-    friend constexpr bool operator ==(const Integral<T>& lhs,
-                                      const Integral<T>& rhs)
+    friend constexpr bool operator ==(const Integral& lhs,
+                                      const Integral& rhs)
                                       noexcept {
-        return lhs.m_value == rhs.m_value;
+        return compare(lhs, rhs) == 0;
     }
 
     /**
@@ -394,10 +3013,10 @@ public:
      *
      * @return True if not equal, false otherwise
      */
-    friend constexpr bool operator !=(const Integral<T>& lhs,
-                                      const Integral<T>& rhs)
+    friend constexpr bool operator !=(const Integral& lhs,
+                                      const Integral& rhs)
                                       noexcept {
-        return !(lhs == rhs);
+        return compare(lhs, rhs) != 0;
     }
 
     /**
@@ -408,10 +3027,10 @@ public:
      *
      * @return True if lhs is less than rhs, false otherwise
      */
-    friend constexpr bool operator <(const Integral<T>& lhs,
-                                     const Integral<T>& rhs)
+    friend constexpr bool operator <(const Integral& lhs,
+                                     const Integral& rhs)
                                      noexcept {
-        return lhs.m_value < rhs.m_value;
+        return compare(lhs, rhs) < 0;
     }
 
     /**
@@ -422,10 +3041,10 @@ public:
      *
      * @return True if lhs is greater than rhs, false otherwise
      */
-    friend constexpr bool operator >(const Integral<T>& lhs,
-                                     const Integral<T>& rhs)
+    friend constexpr bool operator >(const Integral& lhs,
+                                     const Integral& rhs)
                                      noexcept {
-        return !(lhs < rhs);
+        return compare(lhs, rhs) > 0;
     }
 
     /**
@@ -434,26 +3053,70 @@ public:
      * @param lhs Left hand operand
      * @param rhs Right hand operand
      *
-     * @return True if lhs is less than or equal to rhs, false otherwise
+     * @return True if lhs is less than or equal to rhs, false otherwise
+     */
+    friend constexpr bool operator <=(const Integral& lhs,
+                                      const Integral& rhs)
+                                      noexcept {
+        return compare(lhs, rhs) <= 0;
+    }
+
+    /**
+     * @brief Determines if one value is greater than or equal to the other
+     *
+     * @param lhs Left hand operand
+     * @param rhs Right hand operand
+     *
+     * @return True if lhs is greater than or equal to rhs, false otherwise
+     */
+    friend constexpr bool operator >=(const Integral& lhs,
+                                      const Integral& rhs)
+                                      noexcept {
+        return compare(lhs, rhs) >= 0;
+    }
+
+    //=========================================================================
+    // Parsing Operations
+    //=========================================================================
+
+    /**
+     * @brief Parses the character range [first, last) into an object
+     *
+     * Leading whitespace and an optional sign are accepted, the radix is
+     * selected from the prefix: "0b" for binary, "0x" for hexadecimal, a
+     * leading "0" for octal and decimal otherwise. Parsing stops at the first
+     * character that is not a digit of the selected radix. No memory is
+     * allocated and the current locale is not consulted.
+     *
+     * @param first Beginning of the character range
+     * @param last  End of the character range
+     *
+     * @return Parsed object, zero if no digits were found or the value clamped
+     *         to the representable range if the digits overflow the type
      */
-    friend constexpr bool operator <=(const Integral<T>& lhs,
-                                      const Integral<T>& rhs)
-                                      noexcept {
-        return (lhs < rhs) || (lhs == rhs);
+    static constexpr Integral parse(const char* first,
+                                    const char* last) noexcept {
+        T value{};
+        detail::parseIntegral(first, last, value);
+        return Integral{value};
     }
 
     /**
-     * @brief Determines if one value is greater than or equal to the other
+     * @brief Parses the character range [first, last) into the specified
+     *        object following the rules of parse(first, last)
      *
-     * @param lhs Left hand operand
-     * @param rhs Right hand operand
+     * The object is left untouched if no digits were found and is clamped to
+     * the representable range if the digits overflow the type
      *
-     * @return True if lhs is greater than or equal to rhs, false otherwise
+     * @param first  Beginning of the character range
+     * @param last   End of the character range
+     * @param object Object to receive the parsed value
+     *
+     * @return Position where parsing stopped and the error condition, if any
      */
-    friend constexpr bool operator >=(const Integral<T>& lhs,
-                                      const Integral<T>& rhs)
-                                      noexcept {
-        return !(lhs <= rhs);
+    static constexpr ParseResult parse(const char* first, const char* last,
+                                       Integral& object) noexcept {
+        return detail::parseIntegral(first, last, object.m_value);
     }
 
     //=========================================================================
@@ -463,10 +3126,20 @@ public:
     /**
      * @brief Converts the object to a C-String
      *
+     * The characters live in storage owned by the calling thread which is
+     * reused by the next conversion of an object of this type on that thread,
+     * so two conversions within one expression yield the same text
+     *
+     * @deprecated Use dec().c_str(), whose characters live as long as the
+     *             string returned, or to_chars()
+     *
      * @return A C-String representation of the object
      */
-    constexpr operator const char*() const noexcept {
-        return std::to_string(m_value).c_str();
+    [[deprecated("use dec().c_str() or to_chars(), the buffer is shared")]]
+    operator const char*() const noexcept {
+        static thread_local string_type buffer;
+        buffer = dec();
+        return buffer.c_str();
     }
 
     /**
@@ -474,8 +3147,9 @@ public:
      *
      * @return A std::string object representation of the object
      */
-    constexpr operator std::string() const noexcept {
-        return std::to_string(m_value);
+    operator std::string() const {
+        const string_type text = dec();
+        return std::string(text.data(), text.size());
     }
 
     /**
@@ -499,73 +3173,129 @@ public:
     // Conversion to Specified Radix
     //=========================================================================
 
+    /**
+     * @brief Writes the representation of the underlying value in the
+     *        specified radix to the character range [first, last)
+     *
+     * Follows the rules of std::to_chars: negative values are written as a
+     * minus sign followed by their magnitude, letters are lower case, no
+     * prefix or null terminator is written and no memory is allocated
+     *
+     * @param first Beginning of the destination range
+     * @param last  End of the destination range
+     * @param radix Base in the range [2, 36] to convert the value to
+     *
+     * @return One past the last character written and the error condition,
+     *         if any
+     */
+    constexpr ToCharsResult to_chars(char* first, char* last,
+                                     const unsigned radix = 10)
+                                     const noexcept {
+        using U = detail::MakeUnsigned<T>;
+
+        if ((radix < 2) || (radix > 36)) {
+            return {last, std::errc::invalid_argument};
+        }
+
+        U magnitude = static_cast<U>(m_value);
+        if (m_value < T{}) {
+            if (first == last) {
+                return {last, std::errc::value_too_large};
+            }
+            *first++  = '-';
+            magnitude = static_cast<U>(U{} - magnitude);
+        }
+
+        return detail::formatRadix(first, last, magnitude, radix);
+    }
+
     /**
      * @brief Performs a conversion of the underlying value to the specified
      *        representation
      *
+     * Base 10 representations carry the sign of the value while every other
+     * radix represents the bit pattern of the value as the std::hex and
+     * std::oct stream manipulators do
+     *
      * Special Cases:
-     * - If the supplied radix is zero(0) then default base 10 representation is
-     *   returned.
+     * - If the supplied radix is less than two(2) then default base 10
+     *   representation is returned.
      * - If the supplied radix is greater than sixteen(16) then default base 10
      *   representation is returned as conversions to those are not commonly
      *   used.
      *
      * @param radix Base to convert the underlying value to
      * 
-     * @return A C-String representation of the converted underlying value
+     * @return An inline string holding the converted underlying value
      */
-    constexpr const char* toRadix(std::size_t radix) const noexcept {
+    constexpr string_type toRadix(std::size_t radix) const noexcept {
+        using U = detail::MakeUnsigned<T>;
 
         // Enforce pre-conditions
-        if (!radix || (radix > 16)) {
-            return std::to_string(m_value).c_str();
-        }
-
-        std::string       result;
-        std::stringstream result_buffer;
-
-        // Use library to produce hexadecimal representation
-        if (radix == 16) {
-            result_buffer << std::hex;
-            result_buffer << m_value;
-            result_buffer >> result;
+        if ((radix < 2) || (radix > 16)) {
+            radix = 10;
         }
 
-        // Use library to produce octal representation
-        else if (radix == 8) {
-            result_buffer << std::oct;
-            result_buffer << m_value;
-            result_buffer >> result;
-        }
-
-        // Use mathematical formula for base transformation
-        else {
-            T value = m_value;
-            std::stack<int> result_stack;
-
-            while (value != 0) {
-                result_stack.push(value % radix);
-                value /= radix;
-            }
+        string_type result;
+        char* const first = result.data();
+        char* const last  = first + string_type::capacity();
 
-            while (!result_stack.empty()) {
-                result_buffer << result_stack.top();
-                result_stack.pop();
-            }
+        const ToCharsResult written = (radix == 10)
+            ? to_chars(first, last, 10)
+            : detail::formatRadix(first, last, static_cast<U>(m_value),
+                                  static_cast<unsigned>(radix));
 
-            result_buffer >> result;
-        }
+        result.resize(static_cast<std::size_t>(written.ptr - first));
+        return result;
+    }
 
-        return (result).c_str();
+    /**
+     * @brief Performs a conversion of the underlying value to the radix
+     *        specified at compile time
+     *
+     * Follows the representation of toRadix(radix) but returns an inline
+     * string sized for exactly the widest value of T in that radix, and can
+     * be evaluated in constant expressions to build tables, protocol
+     * constants or log prefixes at compile time
+     *
+     * Unlike toRadix(radix), which falls back to base 10 above sixteen(16),
+     * radixes 17 to 36 are written in that base with the digits past 'f'
+     * continuing through 'z'; a radix outside [2, 36] does not compile
+     *
+     * @tparam Radix Base in the range [2, 36] to convert the underlying value
+     *               to
+     *
+     * @return An inline string holding the converted underlying value
+     */
+    template<unsigned Radix>
+    constexpr auto toRadix() const noexcept {
+        static_assert((Radix >= 2) && (Radix <= 36),
+                      "Radix must be in the range [2, 36]");
+
+        using U = detail::MakeUnsigned<T>;
+        using result_type = FixedString<detail::maxDigits<U>(Radix)
+                                        + (detail::IntegralTraits<T>::is_signed
+                                           && (Radix == 10))>;
+
+        result_type result;
+        char* const first = result.data();
+        char* const last  = first + result_type::capacity();
+
+        const ToCharsResult written = (Radix == 10)
+            ? to_chars(first, last, 10)
+            : detail::formatRadix(first, last, static_cast<U>(m_value), Radix);
+
+        result.resize(static_cast<std::size_t>(written.ptr - first));
+        return result;
     }
 
     /**
      * @brief Performs a conversion of the underlying value to base 16
      *        representation
      *
-     * @return A C-String representation of the converted underlying value
+     * @return An inline string holding the converted underlying value
      */
-    constexpr const char* hex() const noexcept {
+    constexpr string_type hex() const noexcept {
         return toRadix(16);
     }
 
@@ -573,9 +3303,9 @@ public:
      * @brief Performs a conversion of the underlying value to base 10
      *        representation
      *
-     * @return A C-String representation of the converted underlying value
+     * @return An inline string holding the converted underlying value
      */
-    constexpr const char* dec() const noexcept {
+    constexpr string_type dec() const noexcept {
         return toRadix(10);
     }
 
@@ -583,9 +3313,9 @@ public:
      * @brief Performs a conversion of the underlying value to base 8
      *        representation
      *
-     * @return A C-String representation of the converted underlying value
+     * @return An inline string holding the converted underlying value
      */
-    constexpr const char* oct() const noexcept {
+    constexpr string_type oct() const noexcept {
         return toRadix(8);
     }
 
@@ -593,9 +3323,9 @@ public:
      * @brief Performs a conversion of the underlying value to base 2
      *        representation
      *
-     * @return A C-String representation of the converted underlying value
+     * @return An inline string holding the converted underlying value
      */
-    constexpr const char* bin() const noexcept {
+    constexpr string_type bin() const noexcept {
         return toRadix(2);
     }
 
@@ -606,29 +3336,35 @@ public:
     /**
      * @brief Get minimum between the two objects of this type
      *
+     * Selects with a conditional move rather than a branch, lhs when both
+     * are equal as std::min does
+     *
      * @param lhs Left hand operand
      * @param rhs Right hand operand
-     * 
+     *
      * @return Minimum object between lhs and rhs
      */
-    friend constexpr Integral<T>& min(const Integral<T>& lhs,
-                                      const Integral<T>& rhs)
-                                      noexcept {
-        return const_cast<Integral<T>&>((lhs < rhs) ? lhs : rhs);
+    friend constexpr Integral min(const Integral& lhs,
+                                  const Integral& rhs)
+                                  noexcept {
+        return (compare(rhs, lhs) < 0) ? rhs : lhs;
     }
 
     /**
      * @brief Get maximum between the two objects of this type
      *
+     * Selects with a conditional move rather than a branch, lhs when both
+     * are equal as std::max does
+     *
      * @param lhs Left hand operand
      * @param rhs Right hand operand
-     * 
+     *
      * @return Maximum object between lhs and rhs
      */
-    friend constexpr Integral<T>& max(const Integral<T>& lhs,
-                                      const Integral<T>& rhs)
-                                      noexcept {
-        return const_cast<Integral<T>&>((lhs > rhs) ? lhs : rhs);
+    friend constexpr Integral max(const Integral& lhs,
+                                  const Integral& rhs)
+                                  noexcept {
+        return (compare(lhs, rhs) < 0) ? rhs : lhs;
     }
 
     //=========================================================================
@@ -659,7 +3395,7 @@ public:
      * @reutrn Minimum value this type can represent
      */
     constexpr static T min() noexcept {
-        return std::numeric_limits<T>::min();
+        return detail::IntegralTraits<T>::min();
     }
 
     /**
@@ -668,7 +3404,266 @@ public:
      * @return Maximum value this type can represent
      */
     constexpr static T max() noexcept {
-        return std::numeric_limits<T>::max();
+        return detail::IntegralTraits<T>::max();
+    }
+
+    //=========================================================================
+    // Bit Manipulation Methods
+    //=========================================================================
+
+    /*
+     * Signed types are operated on through the bit pattern of their value,
+     * as the unsigned type of the same width
+     */
+
+    /**
+     * @brief Count the bits of the value that are set
+     *
+     * @return Number of one bits
+     */
+    constexpr int popcount() const noexcept {
+        return detail::popCount(word());
+    }
+
+    /**
+     * @brief Count the consecutive zero bits from the most significant bit
+     *
+     * @return Number of leading zero bits, the width of T for zero
+     */
+    constexpr int countl_zero() const noexcept {
+        return detail::leadingZeros(word()) - (wordBits - bits);
+    }
+
+    /**
+     * @brief Count the consecutive zero bits from the least significant bit
+     *
+     * @return Number of trailing zero bits, the width of T for zero
+     */
+    constexpr int countr_zero() const noexcept {
+        return (m_value == T{}) ? bits : detail::trailingZeros(word());
+    }
+
+    /**
+     * @brief Get the number of bits needed to represent the value
+     *
+     * @return One plus the position of the most significant one bit, zero
+     *         for zero
+     */
+    constexpr int bit_width() const noexcept {
+        return bits - countl_zero();
+    }
+
+    /**
+     * @brief Get the smallest power of two not less than the value
+     *
+     * @return The power of two, one for zero and zero if it cannot be
+     *         represented
+     */
+    constexpr Integral bit_ceil() const noexcept {
+        using U = detail::MakeUnsigned<T>;
+
+        const int width = (static_cast<U>(m_value) <= 1u)
+                          ? 0
+                          : Integral{static_cast<T>(static_cast<U>(m_value) - 1u)}.bit_width();
+        return Integral{static_cast<T>((width < bits) ? static_cast<U>(U{1} << width)
+                                                      : U{})};
+    }
+
+    /**
+     * @brief Get the largest power of two not greater than the value
+     *
+     * @return The power of two, zero for zero
+     */
+    constexpr Integral bit_floor() const noexcept {
+        using U = detail::MakeUnsigned<T>;
+
+        return Integral{static_cast<T>((m_value == T{})
+                                       ? U{}
+                                       : static_cast<U>(U{1} << (bit_width() - 1)))};
+    }
+
+    /**
+     * @brief Rotate the bits of the value towards the most significant bit
+     *
+     * @param count Number of positions, negative counts rotate the other way
+     *
+     * @return Rotated value, a single ROL where the target has it
+     */
+    constexpr Integral rotl(const int count) const noexcept {
+        using U = detail::MakeUnsigned<T>;
+
+        const unsigned left  = static_cast<unsigned>(count) & (bits - 1u);
+        const unsigned right = (bits - left) & (bits - 1u);
+        const U value = static_cast<U>(m_value);
+        return Integral{static_cast<T>(static_cast<U>(value << left)
+                                       | static_cast<U>(value >> right))};
+    }
+
+    /**
+     * @brief Rotate the bits of the value towards the least significant bit
+     *
+     * @param count Number of positions, negative counts rotate the other way
+     *
+     * @return Rotated value, a single ROR where the target has it
+     */
+    constexpr Integral rotr(const int count) const noexcept {
+        return rotl(static_cast<int>(0u - static_cast<unsigned>(count)));
+    }
+
+    /**
+     * @brief Reverse the order of the bytes of the value
+     *
+     * @return Value with its bytes reversed
+     */
+    constexpr Integral byteswap() const noexcept {
+        return Integral{static_cast<T>(detail::byteSwap(word())
+                                       >> (wordBits - bits))};
+    }
+
+    /**
+     * @brief Reverse the order of the bits of the value
+     *
+     * @return Value with its bits reversed
+     */
+    constexpr Integral bit_reverse() const noexcept {
+        return Integral{static_cast<T>(detail::bitReverse(word())
+                                       >> (wordBits - bits))};
+    }
+
+    /**
+     * @brief Scatter the low order bits of the value to the positions of
+     *        the set bits of a mask, lowest first
+     *
+     * Available for types up to 64 bits, a single PDEP on processors where
+     * it is not microcoded
+     *
+     * @param mask Positions receiving the bits of the value
+     *
+     * @return Value with the scattered bits, every bit outside the mask clear
+     */
+    constexpr Integral deposit_bits(const Integral mask) const noexcept {
+        static_assert(sizeof(T) <= sizeof(std::uint64_t),
+                      "Bit deposit is limited to 64-bit types");
+        return Integral{static_cast<T>(detail::depositBits(word(), mask.word()))};
+    }
+
+    /**
+     * @brief Gather the bits of the value at the positions of the set bits
+     *        of a mask into the low order bits, lowest first
+     *
+     * Available for types up to 64 bits, a single PEXT on processors where
+     * it is not microcoded
+     *
+     * @param mask Positions of the bits to gather
+     *
+     * @return Gathered bits, every bit above popcount(mask) clear
+     */
+    constexpr Integral extract_bits(const Integral mask) const noexcept {
+        static_assert(sizeof(T) <= sizeof(std::uint64_t),
+                      "Bit extraction is limited to 64-bit types");
+        return Integral{static_cast<T>(detail::extractBits(word(), mask.word()))};
+    }
+
+    //=========================================================================
+    // Integer Math Methods
+    //=========================================================================
+
+    /**
+     * @brief Compute the integer square root of the value
+     *
+     * @return Largest value whose square does not exceed the value, zero
+     *         for negative values
+     */
+    constexpr Integral isqrt() const noexcept {
+        using U = detail::MakeUnsigned<T>;
+
+        return Integral{detail::isNegative(m_value)
+                        ? T{}
+                        : static_cast<T>(detail::squareRoot(static_cast<U>(m_value)))};
+    }
+
+    /**
+     * @brief Compute the integer binary logarithm of the value
+     *
+     * @return Position of the most significant one bit, -1 for zero and
+     *         negative values
+     */
+    constexpr int ilog2() const noexcept {
+        return detail::isNegative(m_value) ? -1 : bit_width() - 1;
+    }
+
+    /**
+     * @brief Compute the integer decimal logarithm of the value
+     *
+     * Derived from the bit width and a single comparison against a table of
+     * powers of ten, as is the exact size of decimal representations
+     *
+     * @return Number of decimal digits less one, -1 for zero and negative
+     *         values
+     */
+    constexpr int ilog10() const noexcept {
+        using U = detail::MakeUnsigned<T>;
+
+        return (m_value <= T{})
+               ? -1
+               : static_cast<int>(detail::decimalDigits(
+                     static_cast<detail::FixedWidth<U>>(m_value))) - 1;
+    }
+
+    /**
+     * @brief Raise the value to the specified power by repeated squaring
+     *
+     * @param exponent Power to raise the value to, zero yields one
+     *
+     * @return Result from the operation, overflow handled as Policy
+     *         dictates
+     */
+    constexpr result_type ipow(const unsigned long long exponent)
+                               const noexcept {
+        return Policy::template resolve<Integral>(
+            detail::powOverflow(m_value, exponent));
+    }
+
+    /**
+     * @brief Compute the greatest common divisor of the specified objects
+     *
+     * @param lhs Left hand operand
+     * @param rhs Right hand operand
+     *
+     * @return Greatest common divisor of the magnitudes, zero if both are
+     *         zero
+     */
+    friend constexpr Integral gcd(const Integral& lhs,
+                                  const Integral& rhs) noexcept {
+        return Integral{static_cast<T>(
+            detail::binaryGcd(detail::magnitude(lhs.m_value),
+                              detail::magnitude(rhs.m_value)))};
+    }
+
+    /**
+     * @brief Compute the least common multiple of the specified objects
+     *
+     * @param lhs Left hand operand
+     * @param rhs Right hand operand
+     *
+     * @return Least common multiple of the magnitudes, zero if either is
+     *         zero, overflow handled as Policy dictates
+     */
+    friend constexpr result_type lcm(const Integral& lhs,
+                                     const Integral& rhs) noexcept {
+        using U = detail::MakeUnsigned<T>;
+
+        const U left    = detail::magnitude(lhs.m_value);
+        const U right   = detail::magnitude(rhs.m_value);
+        const U divisor = detail::binaryGcd(left, right);
+
+        U multiple = 0;
+        bool overflow = (divisor != 0)
+                        && __builtin_mul_overflow(static_cast<U>(left / divisor),
+                                                  right, &multiple);
+        overflow |= (multiple > static_cast<U>(detail::IntegralTraits<T>::max()));
+        return Policy::template resolve<Integral>(detail::ArithmeticResult<T>{
+            static_cast<T>(multiple), overflow, detail::IntegralTraits<T>::max()});
     }
 
     //=========================================================================
@@ -679,7 +3674,10 @@ public:
      * @brief Allow this object to retrieve a value from an input stream
      *
      * Skips initial whitespace from the stream and stops on first non-numerical
-     * character
+     * character. Binary, octal, hexadecimal and decimal representations are
+     * recognized by their prefix. Characters are read straight from the stream
+     * buffer without allocating; failbit is set if no digits were found or the
+     * value does not fit this type.
      *
      * @param cin Input stream object
      * @param obj An object of this type
@@ -687,26 +3685,25 @@ public:
      * @return The specified input stream
      */
     friend std::istream& operator >>(std::istream& cin,
-                                     Integral<T>& obj)
-                                     noexcept {
-        std::string reciever;
-        cin >> reciever;
-        obj.m_value = Integral<T>{reciever};
-        return cin;
+                                     Integral& obj) {
+        return detail::extractIntegral(cin, obj.m_value);
     }
 
     /**
      * @brief Allow this object to be streamed to an output stream
      *
+     * The value is formatted on the stack according to the formatting flags,
+     * width and fill character of the stream and written to its stream
+     * buffer in one call
+     *
      * @param cout Output stream object
      * @param obj An object of this type
      *
      * @return The specified output stream
      */
-    friend constexpr std::ostream& operator <<(std::ostream& cout,
-                                               const Integral<T>& obj)
-                                               noexcept {
-        return cout << obj.m_value;
+    friend std::ostream& operator <<(std::ostream& cout,
+                                     const Integral& obj) {
+        return detail::insertIntegral(cout, obj.m_value);
     }
 
 //=========================================================================
@@ -714,13 +3711,26 @@ public:
 //=========================================================================
 private:
     /*
-     * Assignment Operations Helper Method
+     * Increment and Decrement Helper Method, Checked objects report overflow
+     * through the result of the arithmetic operators only
      */
-    constexpr Integral<T>& checkAndAssign(const Integral<T>& carbon_copy)
-                                          noexcept {
-        if (this != &carbon_copy)
-            m_value = carbon_copy.m_value;
-        return *this;
+    static constexpr Integral step(const detail::ArithmeticResult<T>& result)
+                                   noexcept {
+        static_assert(!std::is_same<Policy, overflow::Checked>::value,
+                      "Increment and decrement cannot report overflow, use "
+                      "operator + or operator - of overflow::Checked objects");
+        return Policy::template resolve<Integral>(result);
+    }
+
+    /*
+     * Bit Manipulation Helpers, the value zero extended to the word of the
+     * kernels and the widths of T and of that word
+     */
+    static constexpr int bits     = detail::IntegralTraits<detail::MakeUnsigned<T>>::digits;
+    static constexpr int wordBits = detail::IntegralTraits<detail::BitWord<T>>::digits;
+
+    constexpr detail::BitWord<T> word() const noexcept {
+        return static_cast<detail::MakeUnsigned<T>>(m_value);
     }
 
 //=========================================================================
@@ -729,62 +3739,260 @@ private:
 private:
     T m_value; //< Encapsulated Integral Value
 
-}; //< Integral<T>
+}; //< Integral<T, Policy>
+
+//=========================================================================
+// Layout Guarantees
+//=========================================================================
+
+namespace detail {
+
+/*
+ * Zero Overhead Check, objects must be copyable with memcpy and laid out
+ * exactly as the wrapped type under every policy
+ */
+template<typename T, typename Policy>
+constexpr bool hasZeroOverhead() noexcept {
+    return std::is_trivially_copyable<Integral<T, Policy>>::value &&
+           std::is_trivially_destructible<Integral<T, Policy>>::value &&
+           std::is_standard_layout<Integral<T, Policy>>::value &&
+           (sizeof(Integral<T, Policy>) == sizeof(T)) &&
+           (alignof(Integral<T, Policy>) == alignof(T));
+}
+
+template<typename T>
+constexpr bool isZeroOverhead() noexcept {
+    return hasZeroOverhead<T, overflow::Wrapping>() &&
+           hasZeroOverhead<T, overflow::Saturating>() &&
+           hasZeroOverhead<T, overflow::Checked>() &&
+           hasZeroOverhead<T, overflow::Trapping>();
+}
+
+} //< namespace detail
+
+static_assert(detail::isZeroOverhead<signed char>() &&
+              detail::isZeroOverhead<unsigned char>() &&
+              detail::isZeroOverhead<short>() &&
+              detail::isZeroOverhead<unsigned short>() &&
+              detail::isZeroOverhead<int>() &&
+              detail::isZeroOverhead<unsigned int>() &&
+              detail::isZeroOverhead<long>() &&
+              detail::isZeroOverhead<unsigned long>() &&
+              detail::isZeroOverhead<long long>() &&
+              detail::isZeroOverhead<unsigned long long>(),
+              "Integral must be trivially copyable, standard layout and of "
+              "the same size and alignment as the wrapped type");
+
+#if defined(__SIZEOF_INT128__)
+static_assert(detail::isZeroOverhead<detail::Int128>() &&
+              detail::isZeroOverhead<detail::UInt128>(),
+              "128-bit Integral must be trivially copyable, standard layout "
+              "and of the same size and alignment as the wrapped type");
+#endif
+
+//=========================================================================
+// Morton Encoding
+//=========================================================================
+
+/**
+ * @brief Interleaves two coordinates into a 64-bit Morton (Z-order) key,
+ *        bit i of x lands on bit 2i and bit i of y on bit 2i + 1
+ *
+ * @param x First coordinate
+ * @param y Second coordinate
+ *
+ * @return Morton key of the coordinates
+ */
+constexpr Integral<std::uint64_t> morton_encode(const Integral<std::uint32_t> x,
+                                                const Integral<std::uint32_t> y)
+                                                noexcept {
+    const std::uint32_t coordinates[2] = { x, y };
+    return Integral<std::uint64_t>{detail::mortonEncode(coordinates)};
+}
+
+/**
+ * @brief Interleaves three coordinates into a 64-bit Morton (Z-order) key,
+ *        bit i of x lands on bit 3i, of y on bit 3i + 1 and of z on 3i + 2
+ *
+ * Only the low 21 bits of every coordinate are part of the key
+ *
+ * @param x First coordinate
+ * @param y Second coordinate
+ * @param z Third coordinate
+ *
+ * @return Morton key of the coordinates
+ */
+constexpr Integral<std::uint64_t> morton_encode(const Integral<std::uint32_t> x,
+                                                const Integral<std::uint32_t> y,
+                                                const Integral<std::uint32_t> z)
+                                                noexcept {
+    const std::uint32_t coordinates[3] = { x, y, z };
+    return Integral<std::uint64_t>{detail::mortonEncode(coordinates)};
+}
+
+/**
+ * @brief Splits a 64-bit Morton (Z-order) key into its coordinates
+ *
+ * @tparam Dimensions Number of interleaved coordinates, two or three
+ *
+ * @param key Morton key built by morton_encode
+ *
+ * @return Coordinates of the key in the order they were encoded
+ */
+template<std::size_t Dimensions>
+constexpr std::array<Integral<std::uint32_t>, Dimensions>
+morton_decode(const Integral<std::uint64_t> key) noexcept {
+    static_assert((Dimensions == 2) || (Dimensions == 3),
+                  "Morton keys interleave two or three coordinates");
+
+    std::array<Integral<std::uint32_t>, Dimensions> coordinates{};
+    for (std::size_t axis = 0; axis < Dimensions; ++axis) {
+        coordinates[axis] = detail::mortonDecode<Dimensions>(key, axis);
+    }
+    return coordinates;
+}
+
+namespace detail {
+
+/*
+ * Builds an Integral<T> from the characters of an integer literal, any
+ * literal that does not fit T fails to compile
+ */
+template<typename T, char... Chars>
+constexpr Integral<T> makeLiteral() noexcept {
+    constexpr LiteralValue literal = parseLiteral<Chars...>();
+    static_assert(literal.valid,
+                  "Integral literal has a digit outside of its radix");
+    static_assert(!literal.overflow &&
+                  (literal.value <= static_cast<LiteralWord>(
+                                    IntegralTraits<T>::max())),
+                  "Integral literal is out of range for its type");
+    return Integral<T>{static_cast<T>(literal.value)};
+}
+
+} //< namespace detail
 
 //=========================================================================
 // User Defined Literals
 //=========================================================================
 
+/*
+ * The literals are parsed at compile time from their characters, so decimal,
+ * "0x", "0b" and "0" prefixed literals as well as digit separators are
+ * accepted, and a literal out of range for its type is a compile error rather
+ * than a silent truncation. Negative values are written with the unary minus,
+ * so the magnitude itself must fit: -128_cspic is rejected just like 128_cspic.
+ */
+
+/**
+ * @brief User defined literal to create an Integral<signed char> object
+ */
+template<char... Chars>
+inline constexpr auto operator""_cspic()
+{
+    return detail::makeLiteral<signed char, Chars...>();
+}
+
+/**
+ * @brief User defined literal to create an Integral<short> object
+ */
+template<char... Chars>
+inline constexpr auto operator""_cspis()
+{
+    return detail::makeLiteral<short, Chars...>();
+}
+
+/**
+ * @brief User defined literal to create an Integral<int> object
+ */
+template<char... Chars>
+inline constexpr auto operator""_cspii()
+{
+    return detail::makeLiteral<int, Chars...>();
+}
+
+/**
+ * @brief User defined literal to create an Integral<long> object
+ */
+template<char... Chars>
+inline constexpr auto operator""_cspil()
+{
+    return detail::makeLiteral<long, Chars...>();
+}
+
+/**
+ * @brief User defined literal to create an Integral<long long> object
+ */
+template<char... Chars>
+inline constexpr auto operator""_cspill()
+{
+    return detail::makeLiteral<long long, Chars...>();
+}
+
 /**
  * @brief User defined literal to create an Integral<unsigned char> object
- *
- * @param value Value to be transformed into an Integral<unsigned char> object
  */
-inline constexpr auto operator""_cspiuc(unsigned long long value)
+template<char... Chars>
+inline constexpr auto operator""_cspiuc()
 {
-    return Integral<unsigned char>{value};
+    return detail::makeLiteral<unsigned char, Chars...>();
 }
 
 /**
  * @brief User defined literal to create an Integral<unsigned short> object
- *
- * @param value Value to be transformed into an Integral<unsigned short> object
  */
-inline constexpr auto operator""_cspius(unsigned long long value)
+template<char... Chars>
+inline constexpr auto operator""_cspius()
 {
-    return Integral<unsigned short>{value};
+    return detail::makeLiteral<unsigned short, Chars...>();
 }
 
 /**
  * @brief User defined literal to create an Integral<unsigned int> object
- *
- * @param value Value to be transformed into an Integral<unsigned int> object
  */
-inline constexpr auto operator""_cspiui(unsigned long long value)
+template<char... Chars>
+inline constexpr auto operator""_cspiui()
 {
-    return Integral<unsigned int>{value};
+    return detail::makeLiteral<unsigned int, Chars...>();
 }
 
 /**
  * @brief User defined literal to create an Integral<unsigned long> object
- *
- * @param value Value to be transformed into an Integral<unsigned long> object
  */
-inline constexpr auto operator""_cspiul(unsigned long long value)
+template<char... Chars>
+inline constexpr auto operator""_cspiul()
 {
-    return Integral<unsigned long>{value};
+    return detail::makeLiteral<unsigned long, Chars...>();
 }
 
 /**
  * @brief User defined literal to create an Integral<unsigned long long> object
- *
- * @param value Value to be transformed into an Integral<unsigned long long>
- *        object
  */
-inline constexpr auto operator""_cspiull(unsigned long long value)
+template<char... Chars>
+inline constexpr auto operator""_cspiull()
+{
+    return detail::makeLiteral<unsigned long long, Chars...>();
+}
+
+#if defined(__SIZEOF_INT128__)
+/**
+ * @brief User defined literal to create an Integral<__int128> object
+ */
+template<char... Chars>
+inline constexpr auto operator""_cspi128()
+{
+    return detail::makeLiteral<detail::Int128, Chars...>();
+}
+
+/**
+ * @brief User defined literal to create an Integral<unsigned __int128> object
+ */
+template<char... Chars>
+inline constexpr auto operator""_cspiu128()
 {
-    return Integral<unsigned long long>{value};
+    return detail::makeLiteral<detail::UInt128, Chars...>();
 }
+#endif
 
 } //< namespace compuSUAVE_Professional
 
@@ -0,0 +1,1128 @@
+/*  Copyright(c) 2015, Rico Antonio Felix. All rights reserved.
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *      1. The origin of this software must not be misrepresented; you must not
+ *      claim that you wrote the original software. If you use this software
+ *      in a product, an acknowledgment in the product documentation would be
+ *      appreciated but is not required.
+ *
+ *      2. Altered source versions must be plainly marked as such, and must not
+ *      be misrepresented as being the original software.
+ *
+ *      3. This notice may not be removed or altered from any source
+ *      distribution.
+ */
+
+ /**
+  * @author Rico Antonio Felix <ricoantoniofelix@yahoo.com>
+  */
+
+#ifndef INTEGRAL_ARRAY_CSP_H__
+#define INTEGRAL_ARRAY_CSP_H__
+
+#include "Integral.hpp"
+
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace compuSUAVE_Professional {
+
+//=========================================================================
+// Implementation Details
+//=========================================================================
+namespace detail {
+
+/*
+ * Vector of the specified number of bytes holding lanes of T, operated on
+ * with the generic vector extensions of the compiler
+ */
+template<typename T, std::size_t Bytes>
+struct SimdVector {
+    typedef T type __attribute__((vector_size(Bytes)));
+};
+
+/*
+ * Unaligned loads and stores of whole vectors, element arrays are only
+ * guaranteed the alignment of T
+ *
+ * Vectors are passed by reference throughout the generic kernels, which
+ * compile for the default target and are always inlined into the kernels
+ * of each instruction set; vectors wider than the default target passed by
+ * value would change the calling convention
+ */
+template<typename V>
+__attribute__((always_inline))
+inline void loadVector(V& vector, const void* source) noexcept {
+    __builtin_memcpy(&vector, source, sizeof vector);
+}
+
+template<typename V>
+__attribute__((always_inline))
+inline void storeVector(void* destination, const V& vector) noexcept {
+    __builtin_memcpy(destination, &vector, sizeof vector);
+}
+
+/*
+ * Lane-wise operations, each applies to vectors of its lane type and to
+ * single objects alike; arithmetic is carried out on unsigned lanes, whose
+ * wrap-around is defined and matches the wrapping policy
+ */
+struct AddLanes {
+    template<typename T> using lane = MakeUnsigned<T>;
+    template<typename V>
+    __attribute__((always_inline))
+    static void apply(const V& lhs, const V& rhs, V& out) noexcept {
+        out = lhs + rhs;
+    }
+};
+
+struct SubLanes {
+    template<typename T> using lane = MakeUnsigned<T>;
+    template<typename V>
+    __attribute__((always_inline))
+    static void apply(const V& lhs, const V& rhs, V& out) noexcept {
+        out = lhs - rhs;
+    }
+};
+
+struct MulLanes {
+    template<typename T> using lane = MakeUnsigned<T>;
+    template<typename V>
+    __attribute__((always_inline))
+    static void apply(const V& lhs, const V& rhs, V& out) noexcept {
+        out = lhs * rhs;
+    }
+};
+
+struct MinLanes {
+    template<typename T> using lane = T;
+    template<typename V>
+    __attribute__((always_inline))
+    static void apply(const V& lhs, const V& rhs, V& out) noexcept {
+        out = (rhs < lhs) ? rhs : lhs;
+    }
+};
+
+struct MaxLanes {
+    template<typename T> using lane = T;
+    template<typename V>
+    __attribute__((always_inline))
+    static void apply(const V& lhs, const V& rhs, V& out) noexcept {
+        out = (lhs < rhs) ? rhs : lhs;
+    }
+};
+
+/*
+ * Comparisons yield all ones lanes for vectors and a bool for objects
+ */
+struct EqualLanes {
+    template<typename V, typename Mask>
+    __attribute__((always_inline))
+    static void apply(const V& lhs, const V& rhs, Mask& out) noexcept {
+        out = (lhs == rhs);
+    }
+};
+
+struct LessLanes {
+    template<typename V, typename Mask>
+    __attribute__((always_inline))
+    static void apply(const V& lhs, const V& rhs, Mask& out) noexcept {
+        out = (lhs < rhs);
+    }
+};
+
+struct GreaterLanes {
+    template<typename V, typename Mask>
+    __attribute__((always_inline))
+    static void apply(const V& lhs, const V& rhs, Mask& out) noexcept {
+        out = (lhs > rhs);
+    }
+};
+
+/*
+ * Right hand operands of the kernels, another array or one value applied
+ * to every element
+ */
+template<typename T, typename Policy>
+struct ArrayOperand {
+    const Integral<T, Policy>* elements;
+
+    template<typename V>
+    __attribute__((always_inline))
+    void vector(V& out, const std::size_t index) const noexcept {
+        loadVector(out, elements + index);
+    }
+
+    Integral<T, Policy> scalar(const std::size_t index) const noexcept {
+        return elements[index];
+    }
+};
+
+template<typename T, typename Policy>
+struct BroadcastOperand {
+    Integral<T, Policy> value;
+
+    template<typename V>
+    __attribute__((always_inline))
+    void vector(V& out, std::size_t) const noexcept {
+        out = V{};
+        for (std::size_t lane = 0; lane < sizeof(V) / sizeof(T); ++lane) {
+            out[lane] = static_cast<T>(value);
+        }
+    }
+
+    Integral<T, Policy> scalar(std::size_t) const noexcept {
+        return value;
+    }
+};
+
+/*
+ * Element-wise kernel over whole vectors of the specified width followed
+ * by the remaining elements one at a time
+ */
+template<std::size_t Bytes, typename Operation, typename T, typename Policy,
+         typename Operand>
+__attribute__((always_inline))
+inline void mapKernel(const Integral<T, Policy>* lhs, const Operand& rhs,
+                      Integral<T, Policy>* out, const std::size_t count)
+                      noexcept {
+    using V = typename SimdVector<typename Operation::template lane<T>,
+                                  Bytes>::type;
+    constexpr std::size_t lanes = Bytes / sizeof(T);
+
+    std::size_t i = 0;
+    for (; (i + lanes) <= count; i += lanes) {
+        V lhs_lanes, rhs_lanes, result;
+        loadVector(lhs_lanes, lhs + i);
+        rhs.vector(rhs_lanes, i);
+        Operation::apply(lhs_lanes, rhs_lanes, result);
+        storeVector(out + i, result);
+    }
+    for (; i < count; ++i) {
+        Operation::apply(lhs[i], rhs.scalar(i), out[i]);
+    }
+}
+
+/*
+ * Bit i of the result is set for every element i of a block of 64 elements
+ * satisfying the comparison
+ */
+template<typename Operation, typename T, typename Policy, typename Operand>
+inline std::uint64_t maskScalar(const Integral<T, Policy>* lhs,
+                                const Operand& rhs, const std::size_t first,
+                                const std::size_t count) noexcept {
+    std::uint64_t word = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        bool match;
+        Operation::apply(lhs[first + i], rhs.scalar(first + i), match);
+        word |= static_cast<std::uint64_t>(match) << i;
+    }
+    return word;
+}
+
+/*
+ * Keeps one bit per lane of a mask of one bit per byte, every byte of a
+ * lane holds the same bit
+ */
+template<std::size_t LaneBytes>
+constexpr std::uint64_t laneBits(const std::uint64_t bytes) noexcept {
+    return (LaneBytes == 1)
+           ? bytes
+           : laneBits<LaneBytes / 2>(
+                 compactBits(bytes, std::integral_constant<std::size_t, 2>{}));
+}
+
+template<>
+constexpr std::uint64_t laneBits<1>(const std::uint64_t bytes) noexcept {
+    return bytes;
+}
+
+/*
+ * Comparison kernel writing one 64-bit word per block of 64 elements, the
+ * bits of the last word beyond the count are zero
+ *
+ * The mask of one bit per lane of a comparison result is taken by the
+ * specified instructions, which every instruction set kernel supplies as
+ * its own macro so that they compile for the target of that kernel
+ */
+#define INTEGRAL_CSP_MASK_KERNEL(Bytes, laneMask)                              \
+    using V = typename SimdVector<T, Bytes>::type;                             \
+    constexpr std::size_t lanes = Bytes / sizeof(T);                           \
+                                                                               \
+    std::size_t i = 0;                                                         \
+    for (; (i + 64) <= count; i += 64) {                                       \
+        std::uint64_t word = 0;                                                \
+        for (std::size_t lane = 0; lane < 64; lane += lanes) {                 \
+            V lhs_lanes, rhs_lanes;                                            \
+            loadVector(lhs_lanes, lhs + i + lane);                             \
+            rhs.vector(rhs_lanes, i + lane);                                   \
+            decltype(lhs_lanes < rhs_lanes) matches;                           \
+            Operation::apply(lhs_lanes, rhs_lanes, matches);                   \
+            word |= laneMask(matches) << lane;                                 \
+        }                                                                      \
+        *words++ = word;                                                       \
+    }                                                                          \
+    if (i < count) {                                                           \
+        *words = maskScalar<Operation>(lhs, rhs, i, count - i);                \
+    }
+
+#if defined(INTEGRAL_CSP_X86)
+template<typename Operation, typename T, typename Policy, typename Operand>
+__attribute__((target("sse2")))
+void mapSse2(const Integral<T, Policy>* lhs, const Operand rhs,
+             Integral<T, Policy>* out, const std::size_t count) noexcept {
+    mapKernel<16, Operation>(lhs, rhs, out, count);
+}
+
+template<typename Operation, typename T, typename Policy, typename Operand>
+__attribute__((target("avx2")))
+void mapAvx2(const Integral<T, Policy>* lhs, const Operand rhs,
+             Integral<T, Policy>* out, const std::size_t count) noexcept {
+    mapKernel<32, Operation>(lhs, rhs, out, count);
+}
+
+template<typename Operation, typename T, typename Policy, typename Operand>
+__attribute__((target("avx512f,avx512bw")))
+void mapAvx512(const Integral<T, Policy>* lhs, const Operand rhs,
+               Integral<T, Policy>* out, const std::size_t count) noexcept {
+    mapKernel<64, Operation>(lhs, rhs, out, count);
+}
+
+/*
+ * One bit per lane of a comparison result, taken directly for the lane
+ * widths the instruction set has a mask instruction for and compacted from
+ * the mask of one bit per byte otherwise
+ */
+#define INTEGRAL_CSP_MOVEMASK_SSE2(matches)                                    \
+    ((sizeof(T) == 4)                                                          \
+     ? static_cast<std::uint64_t>(_mm_movemask_ps(                             \
+           _mm_castsi128_ps(reinterpret_cast<__m128i>(matches))))              \
+     : (sizeof(T) == 8)                                                        \
+     ? static_cast<std::uint64_t>(_mm_movemask_pd(                             \
+           _mm_castsi128_pd(reinterpret_cast<__m128i>(matches))))              \
+     : laneBits<sizeof(T)>(static_cast<unsigned>(                              \
+           _mm_movemask_epi8(reinterpret_cast<__m128i>(matches)))))
+
+#define INTEGRAL_CSP_MOVEMASK_AVX2(matches)                                    \
+    ((sizeof(T) == 4)                                                          \
+     ? static_cast<std::uint64_t>(_mm256_movemask_ps(                          \
+           _mm256_castsi256_ps(reinterpret_cast<__m256i>(matches))))           \
+     : (sizeof(T) == 8)                                                        \
+     ? static_cast<std::uint64_t>(_mm256_movemask_pd(                          \
+           _mm256_castsi256_pd(reinterpret_cast<__m256i>(matches))))           \
+     : laneBits<sizeof(T)>(static_cast<unsigned>(                              \
+           _mm256_movemask_epi8(reinterpret_cast<__m256i>(matches)))))
+
+#define INTEGRAL_CSP_MOVEMASK_AVX512(matches)                                  \
+    ((sizeof(T) == 1)                                                          \
+     ? static_cast<std::uint64_t>(                                             \
+           _mm512_movepi8_mask(reinterpret_cast<__m512i>(matches)))            \
+     : (sizeof(T) == 2)                                                        \
+     ? static_cast<std::uint64_t>(                                             \
+           _mm512_movepi16_mask(reinterpret_cast<__m512i>(matches)))           \
+     : (sizeof(T) == 4)                                                        \
+     ? static_cast<std::uint64_t>(_mm512_cmplt_epi32_mask(                     \
+           reinterpret_cast<__m512i>(matches), _mm512_setzero_si512()))        \
+     : static_cast<std::uint64_t>(_mm512_cmplt_epi64_mask(                     \
+           reinterpret_cast<__m512i>(matches), _mm512_setzero_si512())))
+
+template<typename Operation, typename T, typename Policy, typename Operand>
+__attribute__((target("sse2")))
+void maskSse2(const Integral<T, Policy>* lhs, const Operand rhs,
+              std::uint64_t* words, const std::size_t count) noexcept {
+    INTEGRAL_CSP_MASK_KERNEL(16, INTEGRAL_CSP_MOVEMASK_SSE2)
+}
+
+template<typename Operation, typename T, typename Policy, typename Operand>
+__attribute__((target("avx2")))
+void maskAvx2(const Integral<T, Policy>* lhs, const Operand rhs,
+              std::uint64_t* words, const std::size_t count) noexcept {
+    INTEGRAL_CSP_MASK_KERNEL(32, INTEGRAL_CSP_MOVEMASK_AVX2)
+}
+
+template<typename Operation, typename T, typename Policy, typename Operand>
+__attribute__((target("avx512f,avx512bw")))
+void maskAvx512(const Integral<T, Policy>* lhs, const Operand rhs,
+                std::uint64_t* words, const std::size_t count) noexcept {
+    INTEGRAL_CSP_MASK_KERNEL(64, INTEGRAL_CSP_MOVEMASK_AVX512)
+}
+
+#undef INTEGRAL_CSP_MOVEMASK_SSE2
+#undef INTEGRAL_CSP_MOVEMASK_AVX2
+#undef INTEGRAL_CSP_MOVEMASK_AVX512
+#endif
+
+#undef INTEGRAL_CSP_MASK_KERNEL
+
+/*
+ * Applies the operation to every element with the widest vectors supported
+ * by the executing processor
+ */
+template<typename Operation, typename T, typename Policy, typename Operand>
+inline void mapIntegrals(const Integral<T, Policy>* lhs, const Operand rhs,
+                         Integral<T, Policy>* out, const std::size_t count)
+                         noexcept {
+#if defined(INTEGRAL_CSP_X86)
+    if (cpuFeatures().avx512bw) {
+        mapAvx512<Operation>(lhs, rhs, out, count);
+    } else if (cpuFeatures().avx2) {
+        mapAvx2<Operation>(lhs, rhs, out, count);
+    } else {
+        mapSse2<Operation>(lhs, rhs, out, count);
+    }
+#else
+    for (std::size_t i = 0; i < count; ++i) {
+        Operation::apply(lhs[i], rhs.scalar(i), out[i]);
+    }
+#endif
+}
+
+/*
+ * Compares every element with the widest vectors supported by the
+ * executing processor, one bit per element
+ */
+template<typename Operation, typename T, typename Policy, typename Operand>
+inline void maskIntegrals(const Integral<T, Policy>* lhs, const Operand rhs,
+                          std::uint64_t* words, const std::size_t count)
+                          noexcept {
+#if defined(INTEGRAL_CSP_X86)
+    if (cpuFeatures().avx512bw) {
+        maskAvx512<Operation>(lhs, rhs, words, count);
+    } else if (cpuFeatures().avx2) {
+        maskAvx2<Operation>(lhs, rhs, words, count);
+    } else {
+        maskSse2<Operation>(lhs, rhs, words, count);
+    }
+#else
+    for (std::size_t i = 0; i < count; i += 64) {
+        *words++ = maskScalar<Operation>(lhs, rhs, i,
+                                         (count - i < 64) ? count - i : 64);
+    }
+#endif
+}
+
+} //< namespace detail
+
+//=========================================================================
+// Comparison Masks
+//=========================================================================
+
+/**
+ * @brief One bit per element produced by the comparisons of IntegralArray
+ *
+ * Bit (i % 64) of word (i / 64) belongs to element i, the bits of the last
+ * word beyond the size are zero
+ */
+class IntegralMask final {
+
+public:
+
+    /**
+     * @brief Creates a mask of the specified number of cleared bits
+     *
+     * @param size Number of bits
+     */
+    explicit IntegralMask(const std::size_t size = 0)
+    : m_words((size + 63) / 64), m_size{size} {}
+
+    /**
+     * @brief Get the number of bits
+     *
+     * @return Number of bits of the mask
+     */
+    std::size_t size() const noexcept {
+        return m_size;
+    }
+
+    /**
+     * @brief Get the bit of the specified element
+     *
+     * @param index Position of the element
+     *
+     * @return Whether the element satisfied the comparison
+     */
+    bool operator [](const std::size_t index) const noexcept {
+        return (m_words[index / 64] >> (index % 64)) & 1u;
+    }
+
+    /**
+     * @brief Counts the set bits
+     *
+     * @return Number of elements that satisfied the comparison
+     */
+    std::size_t count() const noexcept {
+        std::size_t total = 0;
+        for (const std::uint64_t word : m_words) {
+            total += static_cast<std::size_t>(__builtin_popcountll(word));
+        }
+        return total;
+    }
+
+    /**
+     * @brief Get the words holding the bits
+     *
+     * @return Pointer to the first of (size() + 63) / 64 words
+     */
+    std::uint64_t* data() noexcept {
+        return m_words.data();
+    }
+
+    const std::uint64_t* data() const noexcept {
+        return m_words.data();
+    }
+
+    /**
+     * @brief Combines two masks of the same size bit by bit
+     *
+     * @param lhs Left hand operand
+     * @param rhs Right hand operand
+     *
+     * @return Mask of the bits set in both operands
+     */
+    friend IntegralMask operator &(IntegralMask lhs, const IntegralMask& rhs) {
+        for (std::size_t i = 0; i < lhs.m_words.size(); ++i) {
+            lhs.m_words[i] &= rhs.m_words[i];
+        }
+        return lhs;
+    }
+
+    /**
+     * @brief Combines two masks of the same size bit by bit
+     *
+     * @param lhs Left hand operand
+     * @param rhs Right hand operand
+     *
+     * @return Mask of the bits set in either operand
+     */
+    friend IntegralMask operator |(IntegralMask lhs, const IntegralMask& rhs) {
+        for (std::size_t i = 0; i < lhs.m_words.size(); ++i) {
+            lhs.m_words[i] |= rhs.m_words[i];
+        }
+        return lhs;
+    }
+
+    /**
+     * @brief Inverts every bit of the mask
+     *
+     * @param mask Mask to invert
+     *
+     * @return Mask of the bits cleared in the operand
+     */
+    friend IntegralMask operator ~(IntegralMask mask) {
+        for (std::uint64_t& word : mask.m_words) {
+            word = ~word;
+        }
+        if ((mask.m_size % 64) != 0) {
+            mask.m_words.back() &= (std::uint64_t{1} << (mask.m_size % 64)) - 1;
+        }
+        return mask;
+    }
+
+private:
+    std::vector<std::uint64_t> m_words;
+    std::size_t                m_size;
+
+}; //< IntegralMask
+
+//=========================================================================
+// Contiguous Arrays
+//=========================================================================
+
+/**
+ * @brief Fixed size array of Integral objects stored on cache line
+ *        boundaries, with element-wise operations over the whole array
+ *
+ * Elements are laid out exactly as an array of T. Arithmetic, min and max
+ * and the comparisons process as many elements per instruction as the
+ * widest vector registers of the executing processor hold, selected at
+ * runtime among SSE2, AVX2 and AVX-512, and wrap around as the wrapping
+ * policy does.
+ *
+ * Operations on two arrays cover the elements both of them have, their
+ * result is as long as the shorter operand and compound assignments leave
+ * the elements past the end of a shorter right hand operand unchanged.
+ *
+ * @tparam T Integral type of the elements, up to 64 bits
+ */
+template<typename T>
+class IntegralArray final {
+
+    static_assert(sizeof(T) <= 8,
+                  "IntegralArray elements are limited to 64 bits");
+
+public:
+
+    using value_type     = Integral<T>;
+    using size_type      = std::size_t;
+    using iterator       = value_type*;
+    using const_iterator = const value_type*;
+
+    /**
+     * @brief Boundary every array starts on, one cache line and the width
+     *        of the widest vector registers
+     */
+    static constexpr std::size_t alignment = 64;
+
+    //=========================================================================
+    // Constructors
+    //=========================================================================
+
+    /**
+     * @brief Creates an empty array
+     */
+    IntegralArray() noexcept
+    : m_data{nullptr}, m_size{0} {}
+
+    /**
+     * @brief Creates an array of the specified number of zero elements
+     *
+     * @param size Number of elements
+     */
+    explicit IntegralArray(const size_type size)
+    : IntegralArray(size, value_type{}) {}
+
+    /**
+     * @brief Creates an array of copies of the specified value
+     *
+     * @param size  Number of elements
+     * @param value Value of every element
+     */
+    IntegralArray(const size_type size, const value_type value)
+    : m_data{allocate(size)}, m_size{size} {
+        std::uninitialized_fill_n(m_data, m_size, value);
+    }
+
+    /**
+     * @brief Creates an array holding the specified values
+     *
+     * @param values Values of the elements in order
+     */
+    IntegralArray(std::initializer_list<value_type> values)
+    : IntegralArray(values.begin(), values.end()) {}
+
+    /**
+     * @brief Creates an array holding the values of the specified range
+     *
+     * Takes part in overload resolution only for forward iterators, so that
+     * a count and a value of the same type select the constructor above
+     *
+     * @param first Beginning of the range
+     * @param last  End of the range
+     */
+    template<typename ForwardIterator,
+             typename = std::enable_if_t<std::is_convertible<
+                 typename std::iterator_traits<
+                     ForwardIterator>::iterator_category,
+                 std::forward_iterator_tag>::value>>
+    IntegralArray(const ForwardIterator first, const ForwardIterator last)
+    : m_data{allocate(static_cast<size_type>(std::distance(first, last)))},
+      m_size{static_cast<size_type>(std::distance(first, last))} {
+        std::uninitialized_copy(first, last, m_data);
+    }
+
+    /**
+     * @brief Copy constructor
+     *
+     * @param carbon_copy Array to copy the elements from
+     */
+    IntegralArray(const IntegralArray& carbon_copy)
+    : IntegralArray(carbon_copy.begin(), carbon_copy.end()) {}
+
+    /**
+     * @brief Move constructor, the moved from array is left empty
+     *
+     * @param carbon_copy Array to take the elements from
+     */
+    IntegralArray(IntegralArray&& carbon_copy) noexcept
+    : m_data{std::exchange(carbon_copy.m_data, nullptr)},
+      m_size{std::exchange(carbon_copy.m_size, 0)} {}
+
+    //=========================================================================
+    // Assignment Operations
+    //=========================================================================
+
+    /**
+     * @brief Replaces the elements with copies of those of another array
+     *
+     * @param carbon_copy Array to copy the elements from
+     *
+     * @return Transformed array
+     */
+    IntegralArray& operator =(const IntegralArray& carbon_copy) {
+        IntegralArray copy(carbon_copy);
+        return *this = std::move(copy);
+    }
+
+    /**
+     * @brief Takes the elements of another array, which is left empty
+     *
+     * @param carbon_copy Array to take the elements from
+     *
+     * @return Transformed array
+     */
+    IntegralArray& operator =(IntegralArray&& carbon_copy) noexcept {
+        std::swap(m_data, carbon_copy.m_data);
+        std::swap(m_size, carbon_copy.m_size);
+        return *this;
+    }
+
+    //=========================================================================
+    // Destructor
+    //=========================================================================
+
+    /**
+     * @brief Destructor
+     */
+    ~IntegralArray() {
+        release(m_data);
+    }
+
+    //=========================================================================
+    // Element Access
+    //=========================================================================
+
+    /**
+     * @brief Get the number of elements
+     *
+     * @return Number of elements
+     */
+    size_type size() const noexcept {
+        return m_size;
+    }
+
+    /**
+     * @brief Whether the array has no elements
+     *
+     * @return True if the array is empty
+     */
+    bool empty() const noexcept {
+        return m_size == 0;
+    }
+
+    /**
+     * @brief Get the first element, aligned on the array alignment
+     *
+     * @return Pointer to the elements, null for an empty array
+     */
+    value_type* data() noexcept {
+        return m_data;
+    }
+
+    const value_type* data() const noexcept {
+        return m_data;
+    }
+
+    /**
+     * @brief Get the element at the specified position
+     *
+     * @param index Position of the element, less than size()
+     *
+     * @return Reference to the element
+     */
+    value_type& operator [](const size_type index) noexcept {
+        return m_data[index];
+    }
+
+    const value_type& operator [](const size_type index) const noexcept {
+        return m_data[index];
+    }
+
+    iterator begin() noexcept { return m_data; }
+    iterator end() noexcept { return m_data + m_size; }
+    const_iterator begin() const noexcept { return m_data; }
+    const_iterator end() const noexcept { return m_data + m_size; }
+
+    //=========================================================================
+    // Element-wise Arithmetic
+    //=========================================================================
+
+    /**
+     * @brief Adds the elements of another array to the elements of this one
+     *
+     * Only the first rhs.size() elements change when rhs is the shorter
+     * array, elements of rhs past the end of this array are ignored
+     *
+     * @param rhs Array of addends
+     *
+     * @return Transformed array
+     */
+    IntegralArray& operator +=(const IntegralArray& rhs) noexcept {
+        return apply<detail::AddLanes>(rhs);
+    }
+
+    /**
+     * @brief Adds the specified value to every element
+     *
+     * @param rhs Addend
+     *
+     * @return Transformed array
+     */
+    IntegralArray& operator +=(const value_type rhs) noexcept {
+        return apply<detail::AddLanes>(rhs);
+    }
+
+    /**
+     * @brief Subtracts the elements of another array from the elements of
+     *        this one
+     *
+     * Only the first rhs.size() elements change when rhs is the shorter
+     * array, elements of rhs past the end of this array are ignored
+     *
+     * @param rhs Array of subtrahends
+     *
+     * @return Transformed array
+     */
+    IntegralArray& operator -=(const IntegralArray& rhs) noexcept {
+        return apply<detail::SubLanes>(rhs);
+    }
+
+    /**
+     * @brief Subtracts the specified value from every element
+     *
+     * @param rhs Subtrahend
+     *
+     * @return Transformed array
+     */
+    IntegralArray& operator -=(const value_type rhs) noexcept {
+        return apply<detail::SubLanes>(rhs);
+    }
+
+    /**
+     * @brief Multiplies the elements by the elements of another array
+     *
+     * Only the first rhs.size() elements change when rhs is the shorter
+     * array, elements of rhs past the end of this array are ignored
+     *
+     * @param rhs Array of multipliers
+     *
+     * @return Transformed array
+     */
+    IntegralArray& operator *=(const IntegralArray& rhs) noexcept {
+        return apply<detail::MulLanes>(rhs);
+    }
+
+    /**
+     * @brief Multiplies every element by the specified value
+     *
+     * @param rhs Multiplier
+     *
+     * @return Transformed array
+     */
+    IntegralArray& operator *=(const value_type rhs) noexcept {
+        return apply<detail::MulLanes>(rhs);
+    }
+
+    /**
+     * @brief Element-wise sum of two arrays
+     *
+     * @param lhs Left hand operand
+     * @param rhs Right hand operand
+     *
+     * @return Array of the sums
+     */
+    friend IntegralArray operator +(const IntegralArray& lhs,
+                                    const IntegralArray& rhs) {
+        return map<detail::AddLanes>(lhs, rhs);
+    }
+
+    /**
+     * @brief Adds a value to every element of an array
+     *
+     * @param lhs Array of augends
+     * @param rhs Addend
+     *
+     * @return Array of the sums
+     */
+    friend IntegralArray operator +(const IntegralArray& lhs,
+                                    const value_type rhs) {
+        return map<detail::AddLanes>(lhs, rhs);
+    }
+
+    /**
+     * @brief Element-wise difference of two arrays
+     *
+     * @param lhs Left hand operand
+     * @param rhs Right hand operand
+     *
+     * @return Array of the differences
+     */
+    friend IntegralArray operator -(const IntegralArray& lhs,
+                                    const IntegralArray& rhs) {
+        return map<detail::SubLanes>(lhs, rhs);
+    }
+
+    /**
+     * @brief Subtracts a value from every element of an array
+     *
+     * @param lhs Array of minuends
+     * @param rhs Subtrahend
+     *
+     * @return Array of the differences
+     */
+    friend IntegralArray operator -(const IntegralArray& lhs,
+                                    const value_type rhs) {
+        return map<detail::SubLanes>(lhs, rhs);
+    }
+
+    /**
+     * @brief Element-wise product of two arrays
+     *
+     * @param lhs Left hand operand
+     * @param rhs Right hand operand
+     *
+     * @return Array of the products
+     */
+    friend IntegralArray operator *(const IntegralArray& lhs,
+                                    const IntegralArray& rhs) {
+        return map<detail::MulLanes>(lhs, rhs);
+    }
+
+    /**
+     * @brief Multiplies every element of an array by a value
+     *
+     * @param lhs Array of multiplicands
+     * @param rhs Multiplier
+     *
+     * @return Array of the products
+     */
+    friend IntegralArray operator *(const IntegralArray& lhs,
+                                    const value_type rhs) {
+        return map<detail::MulLanes>(lhs, rhs);
+    }
+
+    //=========================================================================
+    // Element-wise Selection
+    //=========================================================================
+
+    /**
+     * @brief Element-wise lesser of two arrays
+     *
+     * @param lhs Left hand operand
+     * @param rhs Right hand operand
+     *
+     * @return Array of the lesser elements
+     */
+    friend IntegralArray min(const IntegralArray& lhs,
+                             const IntegralArray& rhs) {
+        return map<detail::MinLanes>(lhs, rhs);
+    }
+
+    /**
+     * @brief Clamps every element of an array to an upper bound
+     *
+     * @param lhs Array to clamp
+     * @param rhs Upper bound
+     *
+     * @return Array of the lesser of each element and the bound
+     */
+    friend IntegralArray min(const IntegralArray& lhs, const value_type rhs) {
+        return map<detail::MinLanes>(lhs, rhs);
+    }
+
+    /**
+     * @brief Element-wise greater of two arrays
+     *
+     * @param lhs Left hand operand
+     * @param rhs Right hand operand
+     *
+     * @return Array of the greater elements
+     */
+    friend IntegralArray max(const IntegralArray& lhs,
+                             const IntegralArray& rhs) {
+        return map<detail::MaxLanes>(lhs, rhs);
+    }
+
+    /**
+     * @brief Clamps every element of an array to a lower bound
+     *
+     * @param lhs Array to clamp
+     * @param rhs Lower bound
+     *
+     * @return Array of the greater of each element and the bound
+     */
+    friend IntegralArray max(const IntegralArray& lhs, const value_type rhs) {
+        return map<detail::MaxLanes>(lhs, rhs);
+    }
+
+    //=========================================================================
+    // Element-wise Comparisons
+    //=========================================================================
+
+    /**
+     * @brief Compares two arrays element by element for equality
+     *
+     * @param lhs Left hand operand
+     * @param rhs Right hand operand
+     *
+     * @return Mask of the positions holding equal elements
+     */
+    friend IntegralMask mask_eq(const IntegralArray& lhs,
+                                const IntegralArray& rhs) {
+        return mask<detail::EqualLanes>(lhs, rhs);
+    }
+
+    /**
+     * @brief Compares every element of an array with a value for equality
+     *
+     * @param lhs Array to compare
+     * @param rhs Value to compare with
+     *
+     * @return Mask of the elements equal to the value
+     */
+    friend IntegralMask mask_eq(const IntegralArray& lhs, const value_type rhs) {
+        return mask<detail::EqualLanes>(lhs, rhs);
+    }
+
+    /**
+     * @brief Compares two arrays element by element
+     *
+     * @param lhs Left hand operand
+     * @param rhs Right hand operand
+     *
+     * @return Mask of the positions where lhs holds the lesser element
+     */
+    friend IntegralMask mask_lt(const IntegralArray& lhs,
+                                const IntegralArray& rhs) {
+        return mask<detail::LessLanes>(lhs, rhs);
+    }
+
+    /**
+     * @brief Compares every element of an array with a value
+     *
+     * @param lhs Array to compare
+     * @param rhs Value to compare with
+     *
+     * @return Mask of the elements less than the value
+     */
+    friend IntegralMask mask_lt(const IntegralArray& lhs, const value_type rhs) {
+        return mask<detail::LessLanes>(lhs, rhs);
+    }
+
+    /**
+     * @brief Compares two arrays element by element
+     *
+     * @param lhs Left hand operand
+     * @param rhs Right hand operand
+     *
+     * @return Mask of the positions where lhs holds the greater element
+     */
+    friend IntegralMask mask_gt(const IntegralArray& lhs,
+                                const IntegralArray& rhs) {
+        return mask<detail::GreaterLanes>(lhs, rhs);
+    }
+
+    /**
+     * @brief Compares every element of an array with a value
+     *
+     * @param lhs Array to compare
+     * @param rhs Value to compare with
+     *
+     * @return Mask of the elements greater than the value
+     */
+    friend IntegralMask mask_gt(const IntegralArray& lhs, const value_type rhs) {
+        return mask<detail::GreaterLanes>(lhs, rhs);
+    }
+
+private:
+    using Operand   = detail::ArrayOperand<T, overflow::Wrapping>;
+    using Broadcast = detail::BroadcastOperand<T, overflow::Wrapping>;
+
+    /*
+     * Storage Helper Methods, elements start on the array alignment
+     */
+    static value_type* allocate(const size_type size) {
+        return (size == 0)
+               ? nullptr
+               : static_cast<value_type*>(::operator new(
+                     size * sizeof(value_type), std::align_val_t{alignment}));
+    }
+
+    static void release(value_type* data) noexcept {
+        if (data) {
+            ::operator delete(data, std::align_val_t{alignment});
+        }
+    }
+
+    /*
+     * Element-wise Operation Helper Methods
+     */
+    template<typename Operation>
+    IntegralArray& apply(const IntegralArray& rhs) noexcept {
+        detail::mapIntegrals<Operation>(m_data, Operand{rhs.m_data}, m_data,
+                                        (rhs.m_size < m_size) ? rhs.m_size
+                                                              : m_size);
+        return *this;
+    }
+
+    template<typename Operation>
+    IntegralArray& apply(const value_type rhs) noexcept {
+        detail::mapIntegrals<Operation>(m_data, Broadcast{rhs}, m_data, m_size);
+        return *this;
+    }
+
+    template<typename Operation>
+    static IntegralArray map(const IntegralArray& lhs,
+                             const IntegralArray& rhs) {
+        IntegralArray result(Uninitialized{},
+                             (rhs.m_size < lhs.m_size) ? rhs.m_size
+                                                       : lhs.m_size);
+        detail::mapIntegrals<Operation>(lhs.m_data, Operand{rhs.m_data},
+                                        result.m_data, result.m_size);
+        return result;
+    }
+
+    template<typename Operation>
+    static IntegralArray map(const IntegralArray& lhs, const value_type rhs) {
+        IntegralArray result(Uninitialized{}, lhs.m_size);
+        detail::mapIntegrals<Operation>(lhs.m_data, Broadcast{rhs},
+                                        result.m_data, result.m_size);
+        return result;
+    }
+
+    template<typename Operation>
+    static IntegralMask mask(const IntegralArray& lhs,
+                             const IntegralArray& rhs) {
+        IntegralMask result{(rhs.m_size < lhs.m_size) ? rhs.m_size
+                                                      : lhs.m_size};
+        detail::maskIntegrals<Operation>(lhs.m_data, Operand{rhs.m_data},
+                                         result.data(), result.size());
+        return result;
+    }
+
+    template<typename Operation>
+    static IntegralMask mask(const IntegralArray& lhs, const value_type rhs) {
+        IntegralMask result{lhs.m_size};
+        detail::maskIntegrals<Operation>(lhs.m_data, Broadcast{rhs},
+                                         result.data(), result.size());
+        return result;
+    }
+
+    /*
+     * Results are written in full by the kernels, which makes zeroing them
+     * first wasted bandwidth
+     */
+    struct Uninitialized {};
+
+    IntegralArray(Uninitialized, const size_type size)
+    : m_data{allocate(size)}, m_size{size} {}
+
+    value_type* m_data;
+    size_type   m_size;
+
+}; //< IntegralArray<T>
+
+} //< namespace compuSUAVE_Professional
+
+#endif //< INTEGRAL_ARRAY_CSP_H__
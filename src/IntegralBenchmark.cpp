@@ -0,0 +1,1847 @@
+/*  Copyright(c) 2015, Rico Antonio Felix. All rights reserved.
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *      1. The origin of this software must not be misrepresented; you must not
+ *      claim that you wrote the original software. If you use this software
+ *      in a product, an acknowledgment in the product documentation would be
+ *      appreciated but is not required.
+ *
+ *      2. Altered source versions must be plainly marked as such, and must not
+ *      be misrepresented as being the original software.
+ *
+ *      3. This notice may not be removed or altered from any source
+ *      distribution.
+ */
+
+ /**
+  * @author Rico Antonio Felix <ricoantoniofelix@yahoo.com>
+  */
+
+#include "Integral.hpp"
+#include "IntegralArray.hpp"
+#include "IntegralColumn.hpp"
+#include "IntegralReader.hpp"
+#include "IntegralReduce.hpp"
+#include "IntegralSort.hpp"
+#include "ModIntegral.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include <stack>
+#include <bitset>
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+#include <algorithm>
+#include <numeric>
+#include <charconv>
+#include <cstring>
+#include <ctime>
+#include <thread>
+
+namespace csp = compuSUAVE_Professional;
+
+namespace {
+
+//=========================================================================
+// Measurement Utilities
+//=========================================================================
+
+/*
+ * Prevents the optimizer from discarding the results of a measured loop
+ */
+volatile unsigned long long sink;
+
+/*
+ * Command line settings shared by every measurement
+ */
+struct Settings {
+    std::size_t samples = 5;         //< Timed runs per measurement
+    std::size_t warmups = 1;         //< Untimed runs before the samples
+    const char* filter  = nullptr;   //< Substring a name must contain
+    const char* json    = nullptr;   //< File receiving the results
+};
+
+Settings settings;
+
+/*
+ * Statistics of the samples of one measurement, per operation
+ */
+struct Result {
+    std::string name;
+    std::size_t operations;
+    double      ns_min;
+    double      ns_median;
+    double      ns_mean;
+    double      ns_stddev;
+    double      cycles_median;
+};
+
+std::vector<Result> results;
+
+/*
+ * Monotonic wall clock in nanoseconds
+ */
+double nanoseconds() noexcept
+{
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<double>(now.tv_sec) * 1e9 + static_cast<double>(now.tv_nsec);
+}
+
+/*
+ * Time stamp counter, reference cycles at the nominal frequency of the core,
+ * zero where the target has none
+ */
+unsigned long long cycles() noexcept
+{
+#if defined(INTEGRAL_CSP_X86)
+    _mm_lfence();
+    const unsigned long long ticks = __rdtsc();
+    _mm_lfence();
+    return ticks;
+#else
+    return 0;
+#endif
+}
+
+double median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    const std::size_t middle = values.size() / 2;
+    return (values.size() % 2) ? values[middle]
+                               : (values[middle - 1] + values[middle]) / 2;
+}
+
+/*
+ * Runs the specified function the configured number of warmup and timed
+ * times and reports the cost per operation of the median sample, with the
+ * spread of the samples; measurements excluded by the filter yield NaN
+ */
+template<typename Function>
+double measure(const char* name, std::size_t operations, Function&& function)
+{
+    if (settings.filter && !std::strstr(name, settings.filter)) {
+        return std::nan("");
+    }
+
+    for (std::size_t warmup = 0; warmup < settings.warmups; ++warmup) {
+        function();
+    }
+
+    const double count = static_cast<double>(std::max<std::size_t>(operations, 1));
+    std::vector<double> ns, ticks;
+
+    for (std::size_t sample = 0; sample < std::max<std::size_t>(settings.samples, 1); ++sample) {
+        const double start = nanoseconds();
+        const unsigned long long first = cycles();
+        function();
+        const unsigned long long last = cycles();
+        const double stop = nanoseconds();
+
+        ns.push_back((stop - start) / count);
+        ticks.push_back(static_cast<double>(last - first) / count);
+    }
+
+    double mean = 0;
+    for (double value : ns) {
+        mean += value / static_cast<double>(ns.size());
+    }
+    double variance = 0;
+    for (double value : ns) {
+        variance += (value - mean) * (value - mean) / static_cast<double>(ns.size());
+    }
+
+    const Result result{name, operations, *std::min_element(ns.begin(), ns.end()),
+                        median(ns), mean, std::sqrt(variance), median(ticks)};
+    results.push_back(result);
+
+    std::printf("%-40s %12zu ops %10.2f ns/op %8.2f cyc/op %6.1f%% dev\n",
+                name, operations, result.ns_median, result.cycles_median,
+                (mean > 0) ? 100 * result.ns_stddev / mean : 0.0);
+    return result.ns_median;
+}
+
+/*
+ * Prints a summary line computed from measurements, unless one of them was
+ * excluded by the filter
+ */
+template<typename... Values>
+void report(const char* format, const char* label, const Values... values)
+{
+    for (const double value : { static_cast<double>(values)... }) {
+        if (std::isnan(value)) {
+            return;
+        }
+    }
+    std::printf(format, label, values...);
+}
+
+/*
+ * Writes the string as a JSON string literal
+ */
+void writeJsonString(std::FILE* file, const std::string& value)
+{
+    std::fputc('"', file);
+    for (const char c : value) {
+        if ((c == '"') || (c == '\\')) {
+            std::fprintf(file, "\\%c", c);
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            std::fprintf(file, "\\u%04x", c);
+        } else {
+            std::fputc(c, file);
+        }
+    }
+    std::fputc('"', file);
+}
+
+/*
+ * Writes every result of the run to the specified file as JSON
+ */
+bool writeJson(const char* path, std::size_t operations)
+{
+    std::FILE* file = std::fopen(path, "w");
+    if (!file) {
+        return false;
+    }
+
+    std::fprintf(file, "{\n  \"context\": {\"operations\": %zu, \"samples\": %zu, "
+                       "\"warmups\": %zu, \"timer\": \"clock_gettime(CLOCK_MONOTONIC)\", "
+                       "\"cycles\": \"%s\"},\n  \"benchmarks\": [",
+                 operations, settings.samples, settings.warmups,
+                 cycles() ? "rdtsc" : "none");
+
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result& result = results[i];
+        std::fprintf(file, "%s\n    {\"name\": ", i ? "," : "");
+        writeJsonString(file, result.name);
+        std::fprintf(file, ", \"operations\": %zu, \"ns_per_op\": {\"min\": %.4f, "
+                           "\"median\": %.4f, \"mean\": %.4f, \"stddev\": %.4f}, "
+                           "\"cycles_per_op\": %.4f}",
+                     result.operations, result.ns_min, result.ns_median,
+                     result.ns_mean, result.ns_stddev, result.cycles_median);
+    }
+    std::fprintf(file, "\n  ]\n}\n");
+    return std::fclose(file) == 0;
+}
+
+//=========================================================================
+// Parsing
+//=========================================================================
+
+/*
+ * Body of the std::string constructor before Integral<T>::parse was
+ * introduced, kept as the baseline
+ */
+template<typename T>
+T legacyParse(const std::string& value)
+{
+    T result{};
+
+    if ((value.find("0b") == 0) || (value.find("0B") == 0)) {
+        try {
+            std::bitset<std::numeric_limits<T>::digits> bits{value, 2};
+            result = static_cast<T>(bits.to_ullong());
+        } catch(const std::invalid_argument& ia) {}
+        return result;
+    }
+
+    std::stringstream converter{value};
+
+    if (value.find("0x") == 0) {
+        converter << std::hex;
+    } else if (value.find("0") == 0) {
+        converter << std::oct;
+    }
+
+    converter >> result;
+    return result;
+}
+
+/*
+ * Pool of numeric tokens in every supported representation, weighted
+ * towards decimal as found in CSV input
+ */
+std::vector<std::string> makeTokens(std::size_t count)
+{
+    std::mt19937_64 engine{42};
+    std::vector<std::string> tokens;
+    tokens.reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const long long value = static_cast<long long>(engine() >> (engine() % 64));
+        char buffer[80];
+
+        switch (i % 8) {
+            case 0:  std::snprintf(buffer, sizeof buffer, "0x%llx", value); break;
+            case 1:  std::snprintf(buffer, sizeof buffer, "0%llo",  value); break;
+            case 2:  std::snprintf(buffer, sizeof buffer, "0b%s",
+                                   std::bitset<32>(value).to_string().c_str());
+                     break;
+            default: std::snprintf(buffer, sizeof buffer, "%lld",
+                                   (i % 2) ? value : -value);
+                     break;
+        }
+        tokens.emplace_back(buffer);
+    }
+    return tokens;
+}
+
+void benchParse(std::size_t operations)
+{
+    const auto tokens = makeTokens(1u << 20);
+    const std::size_t mask = tokens.size() - 1;
+
+    const double legacy = measure("parse: stringstream (legacy)", operations, [&] {
+        unsigned long long total = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            total += legacyParse<long long>(tokens[i & mask]);
+        }
+        sink = total;
+    });
+
+    const double engine = measure("parse: Integral(const std::string&)", operations, [&] {
+        unsigned long long total = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            total += (long long)(csp::Integral<long long>{tokens[i & mask]});
+        }
+        sink = total;
+    });
+
+    measure("parse: Integral<T>::parse(first, last)", operations, [&] {
+        unsigned long long total = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            const std::string& token = tokens[i & mask];
+            const char* first = token.data();
+            total += (long long)(csp::Integral<long long>::parse(first, first + token.size()));
+        }
+        sink = total;
+    });
+
+    report("%-40s %10.2fx\n\n", "parse: speedup over legacy", legacy / engine);
+}
+
+//=========================================================================
+// Decimal Formatting
+//=========================================================================
+
+/*
+ * Generic radix loop of toRadix() before the formatting kernels were
+ * introduced, returning the std::string it used to leave dangling
+ */
+template<typename T>
+std::string legacyToRadix(T value, std::size_t radix)
+{
+    std::string       result;
+    std::stringstream result_buffer;
+    std::stack<int>   result_stack;
+
+    while (value != 0) {
+        result_stack.push(value % radix);
+        value /= radix;
+    }
+
+    while (!result_stack.empty()) {
+        result_buffer << result_stack.top();
+        result_stack.pop();
+    }
+
+    result_buffer >> result;
+    return result;
+}
+
+/*
+ * Values drawn uniformly from the whole range, nearly all of which have the
+ * maximum number of digits, or skewed towards small magnitudes where every
+ * digit count is equally likely
+ */
+template<typename T>
+std::vector<T> makeValues(std::size_t count, bool skewed)
+{
+    std::mt19937_64 engine{7};
+    std::vector<T> values(count);
+
+    for (auto& value : values) {
+        const auto random = engine();
+        value = skewed
+                ? static_cast<T>(random % csp::detail::DecimalTables<>::powers[1 + (engine() % std::numeric_limits<T>::digits10)])
+                : static_cast<T>(random);
+    }
+    return values;
+}
+
+template<typename T>
+void benchFormatDecimal(std::size_t operations, const char* width, bool skewed)
+{
+    const auto values = makeValues<T>(1u << 16, skewed);
+    const std::size_t mask = values.size() - 1;
+
+    char label[64];
+    const char* distribution = skewed ? "skewed" : "uniform";
+
+    std::snprintf(label, sizeof label, "dec %s %s: stack loop (legacy)", width, distribution);
+    const double legacy = measure(label, operations / 16, [&] {
+        unsigned long long total = 0;
+        for (std::size_t i = 0; i < operations / 16; ++i) {
+            total += legacyToRadix(values[i & mask], 10).size();
+        }
+        sink = total;
+    });
+
+    std::snprintf(label, sizeof label, "dec %s %s: std::to_string", width, distribution);
+    const double library = measure(label, operations, [&] {
+        unsigned long long total = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            total += std::to_string(values[i & mask]).size();
+        }
+        sink = total;
+    });
+
+    std::snprintf(label, sizeof label, "dec %s %s: Integral<T>::to_chars", width, distribution);
+    const double kernel = measure(label, operations, [&] {
+        unsigned long long total = 0;
+        char buffer[24];
+        for (std::size_t i = 0; i < operations; ++i) {
+            const csp::Integral<T> value{values[i & mask]};
+            total += value.to_chars(buffer, buffer + sizeof buffer).ptr - buffer;
+            total += buffer[0];
+        }
+        sink = total;
+    });
+
+    report("%-40s %10.2fx / %.2fx\n\n", "dec: speedup over legacy / to_string",
+                legacy / kernel, library / kernel);
+}
+
+//=========================================================================
+// Hexadecimal and Binary Formatting
+//=========================================================================
+
+/*
+ * Stream based hexadecimal conversion of toRadix(16) before the formatting
+ * kernels were introduced
+ */
+std::string legacyHex(unsigned long long value)
+{
+    std::string       result;
+    std::stringstream result_buffer;
+
+    result_buffer << std::hex;
+    result_buffer << value;
+    result_buffer >> result;
+    return result;
+}
+
+void benchFormatHexBinary(std::size_t operations)
+{
+    const auto values = makeValues<unsigned long long>(1u << 16, false);
+    const std::size_t mask = values.size() - 1;
+
+    const double legacy = measure("hex 64-bit: stringstream (legacy)", operations / 16, [&] {
+        unsigned long long total = 0;
+        for (std::size_t i = 0; i < operations / 16; ++i) {
+            total += legacyHex(values[i & mask]).size();
+        }
+        sink = total;
+    });
+
+    measure("hex 64-bit: generic radix loop", operations, [&] {
+        unsigned long long total = 0;
+        char buffer[64];
+        for (std::size_t i = 0; i < operations; ++i) {
+            total += csp::detail::formatUnsigned(buffer, buffer + 64, values[i & mask], 16).ptr - buffer;
+            total += buffer[0];
+        }
+        sink = total;
+    });
+
+    measure("hex 64-bit: SWAR kernel", operations, [&] {
+        unsigned long long total = 0;
+        char buffer[16];
+        for (std::size_t i = 0; i < operations; ++i) {
+            csp::detail::hexDigitsSwar(buffer, values[i & mask]);
+            total += buffer[i & 15];
+        }
+        sink = total;
+    });
+
+    const double kernel = measure("hex 64-bit: Integral<T>::to_chars", operations, [&] {
+        unsigned long long total = 0;
+        char buffer[64];
+        for (std::size_t i = 0; i < operations; ++i) {
+            const csp::Integral<unsigned long long> value{values[i & mask]};
+            total += value.to_chars(buffer, buffer + 64, 16).ptr - buffer;
+            total += buffer[0];
+        }
+        sink = total;
+    });
+
+    report("%-40s %10.2fx\n\n", "hex: speedup over legacy", legacy / kernel);
+
+    const double generic = measure("bin 64-bit: generic radix loop", operations, [&] {
+        unsigned long long total = 0;
+        char buffer[64];
+        for (std::size_t i = 0; i < operations; ++i) {
+            total += csp::detail::formatUnsigned(buffer, buffer + 64, values[i & mask], 2).ptr - buffer;
+            total += buffer[0];
+        }
+        sink = total;
+    });
+
+    const double binary = measure("bin 64-bit: Integral<T>::to_chars", operations, [&] {
+        unsigned long long total = 0;
+        char buffer[64];
+        for (std::size_t i = 0; i < operations; ++i) {
+            const csp::Integral<unsigned long long> value{values[i & mask]};
+            total += value.to_chars(buffer, buffer + 64, 2).ptr - buffer;
+            total += buffer[0];
+        }
+        sink = total;
+    });
+
+    report("%-40s %10.2fx\n\n", "bin: speedup over generic loop", generic / binary);
+}
+
+//=========================================================================
+// Decimal Parsing Throughput
+//=========================================================================
+
+/*
+ * Reports the throughput of a parsing loop over a buffer in bytes per
+ * reference cycle of the time stamp counter
+ */
+template<typename Function>
+void measureBytesPerCycle(const char* name, const std::string& buffer,
+                          std::size_t passes, Function&& function)
+{
+    const double ns = measure(name, buffer.size() * passes, [&] {
+        for (std::size_t pass = 0; pass < passes; ++pass) {
+            function(buffer.data(), buffer.data() + buffer.size());
+        }
+    });
+
+    if (!std::isnan(ns) && (results.back().cycles_median > 0)) {
+        std::printf("%-40s %10.3f bytes/cycle\n", name, 1 / results.back().cycles_median);
+    }
+}
+
+/*
+ * Newline separated tokens of exactly the specified number of digits
+ */
+std::string makeDigitTokens(std::size_t count, unsigned digits)
+{
+    std::mt19937_64 engine{11};
+    std::string buffer;
+    buffer.reserve(count * (digits + 1));
+
+    for (std::size_t i = 0; i < count; ++i) {
+        buffer += static_cast<char>('1' + (engine() % 9));
+        for (unsigned digit = 1; digit < digits; ++digit) {
+            buffer += static_cast<char>('0' + (engine() % 10));
+        }
+        buffer += '\n';
+    }
+    return buffer;
+}
+
+/*
+ * Runs the specified accumulation kernel over every token of a buffer
+ */
+template<typename Kernel>
+void parseTokens(const char* first, const char* last, Kernel&& kernel)
+{
+    unsigned long long total = 0;
+    while (first < last) {
+        unsigned long long magnitude = 0;
+        bool overflow = false;
+        first = kernel(first, last, magnitude, overflow) + 1;
+        total += magnitude + overflow;
+    }
+    sink = total;
+}
+
+void benchParseDecimal(std::size_t operations)
+{
+    for (unsigned digits : { 10u, 19u }) {
+        const std::size_t tokens = 1u << 16;
+        const std::string buffer = makeDigitTokens(tokens, digits);
+        const std::size_t passes = (operations / tokens) + 1;
+        char label[64];
+
+        std::snprintf(label, sizeof label, "parse %u digits: scalar", digits);
+        measureBytesPerCycle(label, buffer, passes, [](const char* first, const char* last) {
+            parseTokens(first, last, [](const char* f, const char* l, unsigned long long& m, bool& o) {
+                return csp::detail::accumulateDigits<10>(f, l, m, o);
+            });
+        });
+
+        std::snprintf(label, sizeof label, "parse %u digits: SWAR", digits);
+        measureBytesPerCycle(label, buffer, passes, [](const char* first, const char* last) {
+            parseTokens(first, last, [](const char* f, const char* l, unsigned long long& m, bool& o) {
+                return csp::detail::accumulateDecimalSwar(f, l, m, o);
+            });
+        });
+
+        std::snprintf(label, sizeof label, "parse %u digits: selected", digits);
+        measureBytesPerCycle(label, buffer, passes, [](const char* first, const char* last) {
+            parseTokens(first, last, [](const char* f, const char* l, unsigned long long& m, bool& o) {
+                return csp::detail::accumulateDecimal(f, l, m, o);
+            });
+        });
+
+        std::printf("\n");
+    }
+}
+
+//=========================================================================
+// Column Parsing
+//=========================================================================
+
+void benchParseColumn(std::size_t operations)
+{
+    std::mt19937_64 engine{3};
+    std::string buffer;
+
+    for (std::size_t row = 0; row < operations; ++row) {
+        buffer += std::to_string(static_cast<long long>(engine() >> (engine() % 64)));
+        buffer += '\n';
+    }
+
+    const double megabytes = static_cast<double>(buffer.size()) / (1024.0 * 1024.0);
+    std::vector<csp::Integral<long long>> column(operations);
+
+    const double legacy = measure("column: getline + std::string ctor", operations, [&] {
+        std::istringstream input{buffer};
+        std::string token;
+        std::size_t row = 0;
+        while (std::getline(input, token, '\n')) {
+            column[row++] = csp::Integral<long long>{token};
+        }
+        sink = row;
+    });
+
+    const double batch = measure("column: parse_column", operations, [&] {
+        sink = csp::parse_column<long long>(buffer, '\n', column.data()).rows;
+    });
+
+    report("%-40s %10.1f MB/s vs %.1f MB/s\n\n", "column: throughput",
+                megabytes / (batch * operations * 1e-9),
+                megabytes / (legacy * operations * 1e-9));
+}
+
+//=========================================================================
+// File Reading
+//=========================================================================
+
+void benchReadFile(std::size_t operations)
+{
+    char path[] = "/tmp/IntegralBenchmarkXXXXXX";
+    const int descriptor = mkstemp(path);
+    if (descriptor < 0) {
+        return;
+    }
+    close(descriptor);
+
+    {
+        std::mt19937_64 engine{5};
+        std::ofstream output{path};
+        for (std::size_t i = 0; i < operations; ++i) {
+            output << (engine() >> 1) << '\n';
+        }
+    }
+
+    const double stream = measure("read: std::ifstream >> Integral<T>", operations, [&] {
+        std::ifstream input{path};
+        csp::Integral<long long> value;
+        unsigned long long total = 0;
+        while (input >> value) {
+            total += (long long)(value);
+        }
+        sink = total;
+    });
+
+    measure("read: IntegralReader iterator", operations, [&] {
+        csp::IntegralReader<long long> reader{path};
+        unsigned long long total = 0;
+        for (auto value : reader) {
+            total += (long long)(value);
+        }
+        sink = total;
+    });
+
+    const double mapped = measure("read: IntegralReader batches", operations, [&] {
+        csp::IntegralReader<long long> reader{path};
+        std::vector<csp::Integral<long long>> batch(4096);
+        unsigned long long total = 0;
+        while (const std::size_t count = reader.read(batch.data(), batch.size())) {
+            for (std::size_t i = 0; i < count; ++i) {
+                total += (long long)(batch[i]);
+            }
+        }
+        sink = total;
+    });
+
+    report("%-40s %10.2fx\n\n", "read: speedup over ifstream", stream / mapped);
+    std::remove(path);
+}
+
+//=========================================================================
+// Stream Extraction and Insertion
+//=========================================================================
+
+void benchStreams(std::size_t operations)
+{
+    char path[] = "/tmp/IntegralBenchmarkXXXXXX";
+    const int descriptor = mkstemp(path);
+    if (descriptor < 0) {
+        return;
+    }
+    close(descriptor);
+
+    const auto values = makeValues<long long>(1u << 16, true);
+    const std::size_t mask = values.size() - 1;
+
+    const double legacy_write = measure("ofstream <<: num_put (legacy)", operations, [&] {
+        std::ofstream output{path};
+        for (std::size_t i = 0; i < operations; ++i) {
+            output << values[i & mask] << '\n';
+        }
+    });
+
+    const double write = measure("ofstream <<: Integral<T>", operations, [&] {
+        std::ofstream output{path};
+        for (std::size_t i = 0; i < operations; ++i) {
+            output << csp::Integral<long long>{values[i & mask]} << '\n';
+        }
+    });
+
+    const double legacy_read = measure("ifstream >>: std::string + stringstream (legacy)", operations, [&] {
+        std::ifstream input{path};
+        std::string token;
+        unsigned long long total = 0;
+        while (input >> token) {
+            total += legacyParse<long long>(token);
+        }
+        sink = total;
+    });
+
+    const double read = measure("ifstream >>: Integral<T>", operations, [&] {
+        std::ifstream input{path};
+        csp::Integral<long long> value;
+        unsigned long long total = 0;
+        while (input >> value) {
+            total += (long long)(value);
+        }
+        sink = total;
+    });
+
+    report("%-40s %10.2fx / %.2fx\n\n", "streams: speedup write / read",
+                legacy_write / write, legacy_read / read);
+    std::remove(path);
+}
+
+//=========================================================================
+// Overflow Policies
+//=========================================================================
+
+/*
+ * Accumulates a bounded counter the way metering code does, once with a
+ * hand written range check and once per overflow policy
+ */
+void benchOverflowPolicies(std::size_t operations)
+{
+    std::vector<std::uint32_t> increments(1u << 16);
+    std::mt19937 engine{42};
+    for (auto& increment : increments) {
+        increment = engine() >> 8;
+    }
+    const std::size_t mask = increments.size() - 1;
+
+    const double manual = measure("counter: hand written range check", operations, [&] {
+        std::uint32_t counter = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            const std::uint32_t increment = increments[i & mask];
+            counter = (counter > std::numeric_limits<std::uint32_t>::max() - increment)
+                      ? std::numeric_limits<std::uint32_t>::max()
+                      : counter + increment;
+        }
+        sink = counter;
+    });
+
+    const double saturating = measure("counter: overflow::Saturating", operations, [&] {
+        using saturating = csp::Integral<std::uint32_t, csp::overflow::Saturating>;
+        saturating counter;
+        for (std::size_t i = 0; i < operations; ++i) {
+            counter = counter + saturating{increments[i & mask]};
+        }
+        sink = std::uint32_t(counter);
+    });
+
+    measure("counter: overflow::Checked", operations, [&] {
+        using checked = csp::Integral<std::uint32_t, csp::overflow::Checked>;
+        checked counter;
+        std::size_t overflows = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            const auto result = counter + checked{increments[i & mask]};
+            overflows += result.overflow();
+            counter = result.wrapped();
+        }
+        sink = overflows;
+    });
+
+    measure("counter: overflow::Wrapping", operations, [&] {
+        using wrapping = csp::Integral<std::uint32_t>;
+        wrapping counter;
+        for (std::size_t i = 0; i < operations; ++i) {
+            counter = counter + wrapping{increments[i & mask]};
+        }
+        sink = std::uint32_t(counter);
+    });
+
+    report("%-40s %10.2fx\n\n", "counter: saturating over hand written",
+                manual / saturating);
+}
+
+//=========================================================================
+// Division by Invariant Divisors
+//=========================================================================
+
+/*
+ * Divides a pool of values by a divisor the compiler cannot see, with the
+ * plain operator and with both precomputed dividers
+ */
+template<typename T>
+void benchDivider(std::size_t operations, const char* width)
+{
+    using integral = csp::Integral<T>;
+
+    std::vector<integral> values(1u << 12);
+    std::mt19937_64 engine{42};
+    for (auto& value : values) {
+        value = integral{T(engine())};
+    }
+
+    volatile T hidden = T(7);
+    const integral divisor{T(hidden)};
+    const typename integral::divider            divider{divisor};
+    const typename integral::branchfree_divider branchfree{divisor};
+    const std::size_t mask = values.size() - 1;
+    char name[64];
+
+    std::snprintf(name, sizeof name, "div %s: operator /", width);
+    const double plain = measure(name, operations, [&] {
+        T total = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            total += T(values[i & mask] / divisor);
+        }
+        sink = static_cast<unsigned long long>(total);
+    });
+
+    std::snprintf(name, sizeof name, "div %s: divider", width);
+    const double precomputed = measure(name, operations, [&] {
+        T total = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            total += T(values[i & mask] / divider);
+        }
+        sink = static_cast<unsigned long long>(total);
+    });
+
+    std::snprintf(name, sizeof name, "div %s: branchfree_divider", width);
+    measure(name, operations, [&] {
+        T total = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            total += T(values[i & mask] / branchfree);
+        }
+        sink = static_cast<unsigned long long>(total);
+    });
+
+    std::snprintf(name, sizeof name, "mod %s: operator %%", width);
+    const double plain_mod = measure(name, operations, [&] {
+        T total = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            total += T(values[i & mask] % divisor);
+        }
+        sink = static_cast<unsigned long long>(total);
+    });
+
+    std::snprintf(name, sizeof name, "mod %s: divider", width);
+    const double precomputed_mod = measure(name, operations, [&] {
+        T total = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            total += T(values[i & mask] % divider);
+        }
+        sink = static_cast<unsigned long long>(total);
+    });
+
+    std::snprintf(name, sizeof name, "div %s: speedup / %%", width);
+    report("%-40s %10.2fx / %.2fx\n\n", name, plain / precomputed,
+                plain_mod / precomputed_mod);
+}
+
+//=========================================================================
+// Modular Arithmetic
+//=========================================================================
+
+/*
+ * Accumulates the products of a pool of values and a constant modulo a
+ * runtime modulus, the naive way through a double width product and
+ * operator %, and with each reduction of ModIntegral<T>
+ */
+template<typename T, typename Wide>
+void benchModular(std::size_t operations, const char* width, const T modulus)
+{
+    std::vector<T> values(1u << 12);
+    std::mt19937_64 engine{42};
+    for (auto& value : values) {
+        value = T(engine() % modulus);
+    }
+
+    volatile T hidden = modulus;
+    const T divisor = hidden;
+    const T factor  = T(values[1] | 1u);
+    const std::size_t mask = values.size() - 1;
+    char name[64];
+
+    std::snprintf(name, sizeof name, "mulmod %s: (a * b) %% m", width);
+    const double naive = measure(name, operations, [&] {
+        T total = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            const T product = T((Wide(values[i & mask]) * factor) % divisor);
+            total = csp::detail::modularAdd(total, product, divisor);
+        }
+        sink = static_cast<unsigned long long>(total);
+    });
+
+    const csp::BarrettModulus<T> barrett{csp::Integral<T>{divisor}};
+    std::vector<csp::BarrettIntegral<T>> barrett_values;
+    for (const T value : values) {
+        barrett_values.emplace_back(barrett, value);
+    }
+    const csp::BarrettIntegral<T> barrett_factor{barrett, factor};
+
+    std::snprintf(name, sizeof name, "mulmod %s: Barrett", width);
+    const double barrett_time = measure(name, operations, [&] {
+        csp::BarrettIntegral<T> total{barrett};
+        for (std::size_t i = 0; i < operations; ++i) {
+            total = total + barrett_values[i & mask] * barrett_factor;
+        }
+        sink = static_cast<unsigned long long>(T(total.value()));
+    });
+
+    const csp::MontgomeryModulus<T> montgomery{csp::Integral<T>{divisor}};
+    std::vector<csp::MontgomeryIntegral<T>> montgomery_values;
+    for (const T value : values) {
+        montgomery_values.emplace_back(montgomery, value);
+    }
+    const csp::MontgomeryIntegral<T> montgomery_factor{montgomery, factor};
+
+    std::snprintf(name, sizeof name, "mulmod %s: Montgomery", width);
+    const double montgomery_time = measure(name, operations, [&] {
+        csp::MontgomeryIntegral<T> total{montgomery};
+        for (std::size_t i = 0; i < operations; ++i) {
+            total = total + montgomery_values[i & mask] * montgomery_factor;
+        }
+        sink = static_cast<unsigned long long>(T(total.value()));
+    });
+
+    std::snprintf(name, sizeof name, "mulmod %s: speedup B / M", width);
+    report("%-40s %10.2fx / %.2fx\n\n", name, naive / barrett_time,
+                naive / montgomery_time);
+}
+
+//=========================================================================
+// 128-bit Integrals
+//=========================================================================
+
+void bench128(std::size_t operations)
+{
+    using u128 = unsigned __int128;
+
+    std::mt19937_64 engine{11};
+    std::vector<u128> values(1u << 16);
+    for (auto& value : values) {
+        value = ((u128{engine()} << 64) | engine()) >> (engine() % 128);
+    }
+    const std::size_t mask = values.size() - 1;
+
+    const double legacy = measure("dec 128-bit: digit loop (legacy)", operations / 16, [&] {
+        unsigned long long total = 0;
+        char buffer[40];
+        for (std::size_t i = 0; i < operations / 16; ++i) {
+            u128 value = values[i & mask];
+            char* digit = buffer + sizeof buffer;
+            do {
+                *--digit = static_cast<char>('0' + static_cast<unsigned>(value % 10));
+                value /= 10;
+            } while (value != 0);
+            total += (buffer + sizeof buffer) - digit;
+        }
+        sink = total;
+    });
+
+    const double kernel = measure("dec 128-bit: Integral<T>::to_chars", operations, [&] {
+        unsigned long long total = 0;
+        char buffer[40];
+        for (std::size_t i = 0; i < operations; ++i) {
+            const csp::Integral<u128> value{values[i & mask]};
+            total += value.to_chars(buffer, buffer + sizeof buffer).ptr - buffer;
+            total += buffer[0];
+        }
+        sink = total;
+    });
+
+    report("%-40s %10.2fx\n", "dec 128-bit: speedup over legacy", legacy / kernel);
+
+    measure("mul_wide 64-bit: Integral<T>", operations, [&] {
+        u128 total = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            const csp::Integral<std::uint64_t> lhs{static_cast<std::uint64_t>(values[i & mask])};
+            const csp::Integral<std::uint64_t> rhs{static_cast<std::uint64_t>(i)};
+            total += u128(mul_wide(lhs, rhs));
+        }
+        sink = static_cast<unsigned long long>(total >> 64);
+    });
+    std::printf("\n");
+}
+
+//=========================================================================
+// Bit Manipulation
+//=========================================================================
+
+void benchBits(std::size_t operations)
+{
+    const auto values = makeValues<std::uint64_t>(1u << 16, false);
+    const std::size_t mask = values.size() - 1;
+
+    const double legacy_count = measure("popcount: bit loop (legacy)", operations / 16, [&] {
+        unsigned long long total = 0;
+        for (std::size_t i = 0; i < operations / 16; ++i) {
+            for (std::uint64_t value = values[i & mask]; value != 0; value >>= 1) {
+                total += value & 1u;
+            }
+        }
+        sink = total;
+    });
+
+    const double count = measure("popcount: Integral<T>", operations, [&] {
+        unsigned long long total = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            total += csp::Integral<std::uint64_t>{values[i & mask]}.popcount();
+        }
+        sink = total;
+    });
+
+    const double legacy_reverse = measure("bit_reverse: bit loop (legacy)", operations / 16, [&] {
+        unsigned long long total = 0;
+        for (std::size_t i = 0; i < operations / 16; ++i) {
+            std::uint64_t value = values[i & mask], reversed = 0;
+            for (int bit = 0; bit < 64; ++bit, value >>= 1) {
+                reversed = (reversed << 1) | (value & 1u);
+            }
+            total += reversed;
+        }
+        sink = total;
+    });
+
+    const double reverse = measure("bit_reverse: Integral<T>", operations, [&] {
+        unsigned long long total = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            total += std::uint64_t(csp::Integral<std::uint64_t>{values[i & mask]}.bit_reverse());
+        }
+        sink = total;
+    });
+
+    report("%-40s %10.2fx / %.2fx\n\n", "bits: speedup popcount / bit_reverse",
+                legacy_count / count, legacy_reverse / reverse);
+}
+
+//=========================================================================
+// Morton Encoding
+//=========================================================================
+
+void benchMorton(std::size_t operations)
+{
+    const auto values = makeValues<std::uint64_t>(1u << 16, false);
+    const std::size_t mask = values.size() - 1;
+
+    const double legacy = measure("morton 2D: bit loop (legacy)", operations / 16, [&] {
+        unsigned long long total = 0;
+        for (std::size_t i = 0; i < operations / 16; ++i) {
+            const std::uint64_t value = values[i & mask];
+            std::uint64_t key = 0;
+            for (int bit = 0; bit < 32; ++bit) {
+                key |= ((value >> bit) & 1u) << (2 * bit);
+                key |= ((value >> (bit + 32)) & 1u) << (2 * bit + 1);
+            }
+            total += key;
+        }
+        sink = total;
+    });
+
+    const double encode = measure("morton 2D: morton_encode", operations, [&] {
+        unsigned long long total = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            const std::uint64_t value = values[i & mask];
+            total += std::uint64_t(csp::morton_encode(std::uint32_t(value),
+                                                      std::uint32_t(value >> 32)));
+        }
+        sink = total;
+    });
+
+    const double decode = measure("morton 3D: morton_decode", operations, [&] {
+        unsigned long long total = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            const auto coordinates = csp::morton_decode<3>(values[i & mask]);
+            total += std::uint32_t(coordinates[0]) ^ std::uint32_t(coordinates[2]);
+        }
+        sink = total;
+    });
+
+    report("%-40s %10.2fx (%.0f M keys/s, %.0f M decodes/s)\n\n",
+                "morton: speedup over legacy", legacy / encode,
+                1e3 / encode, 1e3 / decode);
+}
+
+//=========================================================================
+// Integer Math
+//=========================================================================
+
+void benchMath(std::size_t operations)
+{
+    const auto values = makeValues<std::uint64_t>(1u << 16, true);
+    const std::size_t mask = values.size() - 1;
+
+    const double legacy_root = measure("isqrt: std::sqrt (legacy)", operations, [&] {
+        unsigned long long total = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            total += static_cast<std::uint64_t>(std::sqrt(static_cast<long double>(values[i & mask])));
+        }
+        sink = total;
+    });
+
+    const double root = measure("isqrt: Integral<T>", operations, [&] {
+        unsigned long long total = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            total += std::uint64_t(csp::Integral<std::uint64_t>{values[i & mask]}.isqrt());
+        }
+        sink = total;
+    });
+
+    const double legacy_log = measure("ilog10: division loop (legacy)", operations, [&] {
+        unsigned long long total = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            int digits = 0;
+            for (std::uint64_t value = values[i & mask]; value >= 10; value /= 10) {
+                ++digits;
+            }
+            total += digits;
+        }
+        sink = total;
+    });
+
+    const double log = measure("ilog10: Integral<T>", operations, [&] {
+        unsigned long long total = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            total += csp::Integral<std::uint64_t>{values[i & mask]}.ilog10();
+        }
+        sink = total;
+    });
+
+    const double legacy_gcd = measure("gcd: Euclid (legacy)", operations / 4, [&] {
+        unsigned long long total = 0;
+        for (std::size_t i = 0; i < operations / 4; ++i) {
+            std::uint64_t a = values[i & mask], b = values[(i + 1) & mask];
+            while (b != 0) {
+                const std::uint64_t r = a % b;
+                a = b;
+                b = r;
+            }
+            total += a;
+        }
+        sink = total;
+    });
+
+    const double binary_gcd = measure("gcd: Integral<T>", operations / 4, [&] {
+        unsigned long long total = 0;
+        for (std::size_t i = 0; i < operations / 4; ++i) {
+            total += std::uint64_t(gcd(csp::Integral<std::uint64_t>{values[i & mask]},
+                                       csp::Integral<std::uint64_t>{values[(i + 1) & mask]}));
+        }
+        sink = total;
+    });
+
+    report("%-40s %10.2fx / %.2fx / %.2fx\n\n", "math: speedup isqrt / ilog10 / gcd",
+                legacy_root / root, legacy_log / log, legacy_gcd / binary_gcd);
+}
+
+//=========================================================================
+// Comparison
+//=========================================================================
+
+void benchCompare(std::size_t operations)
+{
+    const auto values = makeValues<long long>(1u << 20, false);
+    const std::size_t rounds = std::max<std::size_t>(1, operations / (values.size() * 20));
+
+    const double raw = measure("std::sort: long long", rounds * values.size(), [&] {
+        for (std::size_t round = 0; round < rounds; ++round) {
+            std::vector<long long> keys{values};
+            std::sort(keys.begin(), keys.end());
+            sink = static_cast<unsigned long long>(keys[round & 0xFF]);
+        }
+    });
+
+    const double wrapped = measure("std::sort: Integral<T>", rounds * values.size(), [&] {
+        for (std::size_t round = 0; round < rounds; ++round) {
+            std::vector<csp::Integral<long long>> keys(values.begin(), values.end());
+            std::sort(keys.begin(), keys.end());
+            sink = static_cast<unsigned long long>((long long)(keys[round & 0xFF]));
+        }
+    });
+
+    const double reversed = measure("std::sort greater: Integral<T>", rounds * values.size(), [&] {
+        for (std::size_t round = 0; round < rounds; ++round) {
+            std::vector<csp::Integral<long long>> keys(values.begin(), values.end());
+            std::sort(keys.begin(), keys.end(),
+                      [](const csp::Integral<long long>& lhs,
+                         const csp::Integral<long long>& rhs) { return lhs > rhs; });
+            sink = static_cast<unsigned long long>((long long)(keys[round & 0xFF]));
+        }
+    });
+
+    report("%-40s %10.2fx / %.2fx\n\n", "sort: overhead over raw < / >",
+                wrapped / raw, reversed / raw);
+}
+
+//=========================================================================
+// Operators Against Raw T
+//=========================================================================
+
+/*
+ * Measures an operation applied to Integral<T> operands against the same
+ * operation written by hand on T, with the results of the wrapping policy
+ */
+template<typename T, typename Wrapped, typename Raw>
+void measurePair(const char* width, const char* operation, std::size_t operations,
+                 const std::vector<T>& lhs, const std::vector<T>& rhs,
+                 Wrapped&& wrapped, Raw&& raw)
+{
+    using I = csp::Integral<T>;
+
+    const std::vector<I> wrapped_lhs(lhs.begin(), lhs.end());
+    const std::vector<I> wrapped_rhs(rhs.begin(), rhs.end());
+    const std::size_t mask = lhs.size() - 1;
+
+    char label[64];
+    std::snprintf(label, sizeof label, "%s %s: raw T", operation, width);
+    const double base = measure(label, operations, [&] {
+        unsigned long long total = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            total += static_cast<unsigned long long>(raw(lhs[i & mask], rhs[i & mask]));
+        }
+        sink = total;
+    });
+
+    std::snprintf(label, sizeof label, "%s %s: Integral<T>", operation, width);
+    const double boxed = measure(label, operations, [&] {
+        unsigned long long total = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            total += static_cast<unsigned long long>(wrapped(wrapped_lhs[i & mask],
+                                                             wrapped_rhs[i & mask]));
+        }
+        sink = total;
+    });
+
+    std::snprintf(label, sizeof label, "%s %s: overhead over raw T", operation, width);
+    report("%-40s %10.2fx\n", label, boxed / base);
+}
+
+template<typename T>
+void benchOperators(std::size_t operations, const char* width)
+{
+    using I = csp::Integral<T>;
+    using U = std::make_unsigned_t<T>;
+    constexpr int bits = std::numeric_limits<U>::digits;
+
+    const auto lhs = makeValues<T>(1u << 12, false);
+    const auto rhs = makeValues<T>(1u << 12, true);
+
+    // A zero divisor is a precondition under Wrapping, as for the raw types
+    auto divisors = rhs;
+    std::replace(divisors.begin(), divisors.end(), T(0), T(1));
+
+    const auto wrap = [](unsigned long long value) { return static_cast<T>(static_cast<U>(value)); };
+    const auto word = [](T value) { return static_cast<unsigned long long>(static_cast<U>(value)); };
+
+    measurePair(width, "+", operations, lhs, rhs,
+                [](I a, I b) { return T(a + b); },
+                [&](T a, T b) { return wrap(word(a) + word(b)); });
+    measurePair(width, "-", operations, lhs, rhs,
+                [](I a, I b) { return T(a - b); },
+                [&](T a, T b) { return wrap(word(a) - word(b)); });
+    measurePair(width, "*", operations, lhs, rhs,
+                [](I a, I b) { return T(a * b); },
+                [&](T a, T b) { return wrap(word(a) * word(b)); });
+    measurePair(width, "/", operations, lhs, divisors,
+                [](I a, I b) { return T(a / b); },
+                [&](T a, T b) {
+                    return (std::is_signed<T>::value && (b == T(-1))) ? wrap(0 - word(a)) : T(a / b);
+                });
+    measurePair(width, "%", operations, lhs, divisors,
+                [](I a, I b) { return T(a % b); },
+                [](T a, T b) {
+                    return (std::is_signed<T>::value && (b == T(-1))) ? T(0) : T(a % b);
+                });
+    measurePair(width, "unary -", operations, lhs, rhs,
+                [](I a, I) { return T(-a); },
+                [&](T a, T) { return wrap(0 - word(a)); });
+    measurePair(width, "++", operations, lhs, rhs,
+                [](I a, I) { return T(++a); },
+                [&](T a, T) { return wrap(word(a) + 1); });
+    measurePair(width, "--", operations, lhs, rhs,
+                [](I a, I) { return T(--a); },
+                [&](T a, T) { return wrap(word(a) - 1); });
+    measurePair(width, "==", operations, lhs, rhs,
+                [](I a, I b) { return a == b; },
+                [](T a, T b) { return a == b; });
+    measurePair(width, "<", operations, lhs, rhs,
+                [](I a, I b) { return a < b; },
+                [](T a, T b) { return a < b; });
+    measurePair(width, "compare", operations, lhs, rhs,
+                [](I a, I b) { return compare(a, b).value() + 1; },
+                [](T a, T b) { return (a > b) - (a < b) + 1; });
+    measurePair(width, "min", operations, lhs, rhs,
+                [](I a, I b) { return T(min(a, b)); },
+                [](T a, T b) { return (b < a) ? b : a; });
+    measurePair(width, "max", operations, lhs, rhs,
+                [](I a, I b) { return T(max(a, b)); },
+                [](T a, T b) { return (a < b) ? b : a; });
+    measurePair(width, "popcount", operations, lhs, rhs,
+                [](I a, I) { return a.popcount(); },
+                [&](T a, T) { return __builtin_popcountll(word(a)); });
+    measurePair(width, "countl_zero", operations, lhs, rhs,
+                [](I a, I) { return a.countl_zero(); },
+                [&](T a, T) { return a ? __builtin_clzll(word(a)) - (64 - bits) : bits; });
+    measurePair(width, "countr_zero", operations, lhs, rhs,
+                [](I a, I) { return a.countr_zero(); },
+                [&](T a, T) { return a ? __builtin_ctzll(word(a)) : bits; });
+    measurePair(width, "rotl", operations, lhs, rhs,
+                [](I a, I b) { return T(a.rotl(int(b))); },
+                [&](T a, T b) {
+                    const unsigned left = static_cast<unsigned>(b) & (bits - 1u);
+                    return wrap((word(a) << left) | (word(a) >> ((bits - left) & (bits - 1u))));
+                });
+    measurePair(width, "byteswap", operations, lhs, rhs,
+                [](I a, I) { return T(a.byteswap()); },
+                [&](T a, T) { return wrap(__builtin_bswap64(word(a)) >> (64 - bits)); });
+    std::printf("\n");
+}
+
+//=========================================================================
+// Conversions Against the Standard Library
+//=========================================================================
+
+template<typename T>
+void benchConversions(std::size_t operations, const char* width)
+{
+    using I = csp::Integral<T>;
+
+    const auto values = makeValues<T>(1u << 12, true);
+    const std::size_t mask = values.size() - 1;
+
+    std::string decimal, hexadecimal;
+    std::vector<std::size_t> decimal_ends, hexadecimal_ends;
+    for (const T value : values) {
+        char buffer[32];
+        decimal.append(buffer, std::to_chars(buffer, buffer + sizeof buffer, value).ptr);
+        decimal_ends.push_back(decimal.size());
+        hexadecimal.append("0x");
+        hexadecimal.append(buffer, std::to_chars(buffer, buffer + sizeof buffer,
+                                                 static_cast<std::make_unsigned_t<T>>(value),
+                                                 16).ptr);
+        hexadecimal_ends.push_back(hexadecimal.size());
+    }
+
+    const auto token = [](const std::string& text, const std::vector<std::size_t>& ends,
+                          std::size_t i, std::size_t skip) {
+        const char* first = text.data() + (i ? ends[i - 1] : 0) + skip;
+        return std::make_pair(first, text.data() + ends[i]);
+    };
+
+    char label[64];
+    const auto measureBoth = [&](const char* conversion, auto&& library, auto&& kernel) {
+        std::snprintf(label, sizeof label, "%s %s: std library", conversion, width);
+        const double base = measure(label, operations, [&] {
+            unsigned long long total = 0;
+            for (std::size_t i = 0; i < operations; ++i) {
+                total += library(i & mask);
+            }
+            sink = total;
+        });
+
+        std::snprintf(label, sizeof label, "%s %s: Integral<T>", conversion, width);
+        const double wrapped = measure(label, operations, [&] {
+            unsigned long long total = 0;
+            for (std::size_t i = 0; i < operations; ++i) {
+                total += kernel(i & mask);
+            }
+            sink = total;
+        });
+
+        std::snprintf(label, sizeof label, "%s %s: speedup over std", conversion, width);
+        report("%-40s %10.2fx\n", label, base / wrapped);
+    };
+
+    measureBoth("to_chars dec",
+                [&](std::size_t i) {
+                    char buffer[32];
+                    return std::to_chars(buffer, buffer + sizeof buffer, values[i]).ptr - buffer + buffer[0];
+                },
+                [&](std::size_t i) {
+                    char buffer[32];
+                    return I{values[i]}.to_chars(buffer, buffer + sizeof buffer).ptr - buffer + buffer[0];
+                });
+
+    measureBoth("to_chars hex",
+                [&](std::size_t i) {
+                    char buffer[32];
+                    return std::to_chars(buffer, buffer + sizeof buffer,
+                                         static_cast<std::make_unsigned_t<T>>(values[i]), 16).ptr
+                           - buffer + buffer[0];
+                },
+                [&](std::size_t i) {
+                    char buffer[32];
+                    return I{values[i]}.to_chars(buffer, buffer + sizeof buffer, 16).ptr
+                           - buffer + buffer[0];
+                });
+
+    measureBoth("parse dec",
+                [&](std::size_t i) {
+                    const auto range = token(decimal, decimal_ends, i, 0);
+                    T value{};
+                    std::from_chars(range.first, range.second, value);
+                    return static_cast<unsigned long long>(value);
+                },
+                [&](std::size_t i) {
+                    const auto range = token(decimal, decimal_ends, i, 0);
+                    return static_cast<unsigned long long>(T(I::parse(range.first, range.second)));
+                });
+
+    measureBoth("parse hex",
+                [&](std::size_t i) {
+                    const auto range = token(hexadecimal, hexadecimal_ends, i, 2);
+                    std::make_unsigned_t<T> value{};
+                    std::from_chars(range.first, range.second, value, 16);
+                    return static_cast<unsigned long long>(value);
+                },
+                [&](std::size_t i) {
+                    const auto range = token(hexadecimal, hexadecimal_ends, i, 0);
+                    return static_cast<unsigned long long>(T(I::parse(range.first, range.second)));
+                });
+    std::printf("\n");
+}
+
+//=========================================================================
+// Element-wise Arrays
+//=========================================================================
+
+/*
+ * Measures IntegralArray operations against the same loop over a vector of
+ * Integral<T>, on arrays that stay in the first level cache, with the
+ * bandwidth of the kernels over the bytes read and written per element
+ */
+template<typename T>
+void benchArray(std::size_t operations, const char* width)
+{
+    using I = csp::Integral<T>;
+    constexpr std::size_t size = 4096;
+    const std::size_t passes = std::max<std::size_t>(operations / size, 1);
+
+    const auto lhs = makeValues<T>(size, false);
+    const auto rhs = makeValues<T>(size, true);
+
+    std::vector<I> scalar_lhs(lhs.begin(), lhs.end());
+    const std::vector<I> scalar_rhs(rhs.begin(), rhs.end());
+    csp::IntegralArray<T> array_lhs(lhs.begin(), lhs.end());
+    const csp::IntegralArray<T> array_rhs(rhs.begin(), rhs.end());
+
+    char label[64];
+    std::snprintf(label, sizeof label, "array += %s: scalar loop", width);
+    const double add_scalar = measure(label, passes * size, [&] {
+        for (std::size_t pass = 0; pass < passes; ++pass) {
+            for (std::size_t i = 0; i < size; ++i) {
+                scalar_lhs[i] = scalar_lhs[i] + scalar_rhs[i];
+            }
+            sink = static_cast<unsigned long long>(T(scalar_lhs[pass % size]));
+        }
+    });
+
+    std::snprintf(label, sizeof label, "array += %s: IntegralArray", width);
+    const double add_array = measure(label, passes * size, [&] {
+        for (std::size_t pass = 0; pass < passes; ++pass) {
+            array_lhs += array_rhs;
+            sink = static_cast<unsigned long long>(T(array_lhs[pass % size]));
+        }
+    });
+
+    std::snprintf(label, sizeof label, "array mask_lt %s: scalar loop", width);
+    const double mask_scalar = measure(label, passes * size, [&] {
+        std::vector<std::uint64_t> words(size / 64);
+        for (std::size_t pass = 0; pass < passes; ++pass) {
+            for (std::size_t i = 0; i < size; i += 64) {
+                std::uint64_t word = 0;
+                for (std::size_t lane = 0; lane < 64; ++lane) {
+                    word |= std::uint64_t(scalar_lhs[i + lane] < scalar_rhs[i + lane]) << lane;
+                }
+                words[i / 64] = word;
+            }
+            sink = words[pass % words.size()];
+        }
+    });
+
+    std::snprintf(label, sizeof label, "array mask_lt %s: IntegralArray", width);
+    const double mask_array = measure(label, passes * size, [&] {
+        for (std::size_t pass = 0; pass < passes; ++pass) {
+            sink = mask_lt(array_lhs, array_rhs).count();
+        }
+    });
+
+    const double bytes = 3.0 * sizeof(T);
+    std::snprintf(label, sizeof label, "array %s: speedup += / mask_lt", width);
+    report("%-40s %10.2fx / %.2fx\n", label, add_scalar / add_array,
+           mask_scalar / mask_array);
+    std::snprintf(label, sizeof label, "array %s: GB/s += / mask_lt", width);
+    report("%-40s %10.2f / %.2f\n\n", label, bytes / add_array,
+           (2.0 * sizeof(T)) / mask_array);
+}
+
+//=========================================================================
+// Reductions
+//=========================================================================
+
+/*
+ * Measures the reductions over a range that fits the last level cache
+ * against std::accumulate and the standard algorithms on the raw values,
+ * with the bandwidth of every loop
+ */
+template<typename T>
+void benchReduce(std::size_t operations, const char* width)
+{
+    using I = csp::Integral<T>;
+    using U = std::make_unsigned_t<T>;
+    constexpr std::size_t size = 1u << 20;
+    const std::size_t passes = std::max<std::size_t>(operations / size, 1);
+
+    const auto raw = makeValues<T>(size, false);
+    const std::vector<I> values(raw.begin(), raw.end());
+    const I* first = values.data();
+    const I* last  = first + size;
+
+    const auto bandwidth = [](double ns) { return sizeof(T) / ns; };
+
+    char label[64];
+    std::snprintf(label, sizeof label, "sum %s: std::accumulate", width);
+    const double accumulate = measure(label, passes * size, [&] {
+        for (std::size_t pass = 0; pass < passes; ++pass) {
+            sink = static_cast<unsigned long long>(
+                std::accumulate(raw.begin(), raw.end(), static_cast<long long>(pass)));
+        }
+    });
+
+    std::snprintf(label, sizeof label, "sum %s: reduce_sum", width);
+    const double sum = measure(label, passes * size, [&] {
+        for (std::size_t pass = 0; pass < passes; ++pass) {
+            sink = static_cast<unsigned long long>(
+                static_cast<csp::detail::SumTotal<T>>(csp::reduce_sum(first, last)));
+        }
+    });
+
+    std::snprintf(label, sizeof label, "min %s: std::min_element", width);
+    const double min_element = measure(label, passes * size, [&] {
+        for (std::size_t pass = 0; pass < passes; ++pass) {
+            sink = static_cast<unsigned long long>(*std::min_element(raw.begin(), raw.end()));
+        }
+    });
+
+    std::snprintf(label, sizeof label, "min %s: reduce_min", width);
+    const double least = measure(label, passes * size, [&] {
+        for (std::size_t pass = 0; pass < passes; ++pass) {
+            sink = static_cast<unsigned long long>(T(csp::reduce_min(first, last)));
+        }
+    });
+
+    std::snprintf(label, sizeof label, "popcount %s: scalar loop", width);
+    const double popcount_loop = measure(label, passes * size, [&] {
+        for (std::size_t pass = 0; pass < passes; ++pass) {
+            unsigned long long total = 0;
+            for (const T value : raw) {
+                total += __builtin_popcountll(static_cast<U>(value));
+            }
+            sink = total;
+        }
+    });
+
+    std::snprintf(label, sizeof label, "popcount %s: reduce_popcount", width);
+    const double popcount = measure(label, passes * size, [&] {
+        for (std::size_t pass = 0; pass < passes; ++pass) {
+            sink = csp::reduce_popcount(first, last);
+        }
+    });
+
+    std::vector<std::size_t> counts(256);
+    std::snprintf(label, sizeof label, "histogram %s: scalar loop", width);
+    const double histogram_loop = measure(label, passes * size, [&] {
+        for (std::size_t pass = 0; pass < passes; ++pass) {
+            for (const T value : raw) {
+                ++counts[static_cast<U>(value) & 0xFF];
+            }
+            sink = counts[pass & 0xFF];
+        }
+    });
+
+    std::snprintf(label, sizeof label, "histogram %s: radix_histogram", width);
+    const double histogram = measure(label, passes * size, [&] {
+        for (std::size_t pass = 0; pass < passes; ++pass) {
+            csp::radix_histogram(first, last, 0, 8, counts.data());
+            sink = counts[pass & 0xFF];
+        }
+    });
+
+    std::snprintf(label, sizeof label, "reduce %s: GB/s sum / accumulate", width);
+    report("%-40s %10.2f / %.2f\n", label, bandwidth(sum), bandwidth(accumulate));
+    std::snprintf(label, sizeof label, "reduce %s: GB/s min / min_element", width);
+    report("%-40s %10.2f / %.2f\n", label, bandwidth(least), bandwidth(min_element));
+    std::snprintf(label, sizeof label, "reduce %s: GB/s popcount / loop", width);
+    report("%-40s %10.2f / %.2f\n", label, bandwidth(popcount), bandwidth(popcount_loop));
+    std::snprintf(label, sizeof label, "reduce %s: GB/s histogram / loop", width);
+    report("%-40s %10.2f / %.2f\n\n", label, bandwidth(histogram), bandwidth(histogram_loop));
+}
+
+//=========================================================================
+// Radix Sorting
+//=========================================================================
+
+/*
+ * Measures integral_sort against std::sort on the raw values and on
+ * Integral<T>, every round sorts a fresh copy of the same random keys
+ */
+template<typename T>
+void benchSort(std::size_t operations, const char* width, std::size_t size)
+{
+    using I = csp::Integral<T>;
+    const auto values = makeValues<T>(size, false);
+    const std::size_t rounds = std::max<std::size_t>(1, operations / (size * 20));
+
+    char label[64];
+    std::snprintf(label, sizeof label, "sort %s x%zu: std::sort T", width, size);
+    const double raw = measure(label, rounds * size, [&] {
+        for (std::size_t round = 0; round < rounds; ++round) {
+            std::vector<T> keys{values};
+            std::sort(keys.begin(), keys.end());
+            sink = static_cast<unsigned long long>(keys[round % size]);
+        }
+    });
+
+    std::snprintf(label, sizeof label, "sort %s x%zu: std::sort Integral", width, size);
+    const double wrapped = measure(label, rounds * size, [&] {
+        for (std::size_t round = 0; round < rounds; ++round) {
+            std::vector<I> keys(values.begin(), values.end());
+            std::sort(keys.begin(), keys.end());
+            sink = static_cast<unsigned long long>(T(keys[round % size]));
+        }
+    });
+
+    std::snprintf(label, sizeof label, "sort %s x%zu: integral_sort", width, size);
+    const double radix = measure(label, rounds * size, [&] {
+        for (std::size_t round = 0; round < rounds; ++round) {
+            std::vector<I> keys(values.begin(), values.end());
+            csp::integral_sort(keys.data(), keys.data() + keys.size());
+            sink = static_cast<unsigned long long>(T(keys[round % size]));
+        }
+    });
+
+    std::snprintf(label, sizeof label, "sort %s x%zu: speedup T / Integral", width, size);
+    report("%-40s %10.2fx / %.2fx\n\n", label, raw / radix, wrapped / radix);
+}
+
+/*
+ * Measures the threaded integral_sort from 1 to 64 threads, reporting the
+ * speedup of every thread count over one thread; counts beyond the
+ * hardware threads of the host only show the overhead of the threads
+ */
+/*
+ * Keys shifted right by the specified number of bits cluster in the low
+ * end of the range, where the top digits of every key are zero
+ */
+template<typename T>
+void benchParallelSort(std::size_t operations, const char* width, std::size_t size,
+                       unsigned clustered = 0)
+{
+    using I   = csp::Integral<T>;
+    using Key = csp::detail::RadixKey<T>;
+    auto values = makeValues<T>(size, false);
+    for (T& value : values) {
+        value = static_cast<T>(static_cast<typename Key::type>(value) >> clustered);
+    }
+    const std::size_t rounds = std::max<std::size_t>(1, operations / (size * 20));
+
+    char label[64];
+    if (clustered != 0) {
+        const std::vector<I> keys(values.begin(), values.end());
+        const typename Key::type least = Key::of(csp::reduce_min(keys.data(), keys.data() + size));
+        const typename Key::type span  = static_cast<typename Key::type>(
+            Key::of(csp::reduce_max(keys.data(), keys.data() + size)) - least);
+        std::vector<std::size_t> counts(256);
+        csp::detail::radixSplitHistogram(keys.data(), keys.data() + size, least,
+                                         csp::detail::radixSplitShift<T>(span, 8), counts.data());
+
+        std::snprintf(label, sizeof label, "parallel sort %s x%zu: buckets", width, size);
+        report("%-40s %10zu of %zu non-empty\n", label,
+               static_cast<std::size_t>(std::count_if(counts.begin(), counts.end(),
+                                                      [](std::size_t count) { return count != 0; })),
+               counts.size());
+    }
+    double single = std::nan("");
+    for (std::size_t threads = 1; threads <= 64; threads *= 2) {
+        std::snprintf(label, sizeof label, "parallel sort %s x%zu: %zu threads", width, size, threads);
+        const double elapsed = measure(label, rounds * size, [&] {
+            for (std::size_t round = 0; round < rounds; ++round) {
+                std::vector<I> keys(values.begin(), values.end());
+                csp::integral_sort(keys.data(), keys.data() + keys.size(), threads);
+                sink = static_cast<unsigned long long>(T(keys[round % size]));
+            }
+        });
+        if (threads == 1) {
+            single = elapsed;
+        }
+        std::snprintf(label, sizeof label, "parallel sort %s x%zu: speedup", width, size);
+        report(threads == 64 ? "%-40s %10.2fx at %zu of %u hardware threads\n\n"
+                             : "%-40s %10.2fx at %zu of %u hardware threads\n",
+               label, single / elapsed, threads, std::thread::hardware_concurrency());
+    }
+}
+
+} //< namespace
+
+/*
+ * Usage: IntegralBenchmark [operations] [--samples N] [--warmups N]
+ *                          [--filter TEXT] [--json FILE]
+ *
+ * Every measurement runs its loop the number of warmup times untimed, then
+ * the number of sample times timed, and reports the median sample; --filter
+ * runs only the measurements whose name contains TEXT, and --json writes
+ * every result with its statistics to FILE
+ */
+int main(int argc, char** argv)
+{
+    std::size_t operations = 10000000;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string option{argv[i]};
+        const bool has_value = (i + 1 < argc);
+
+        if ((option == "--samples") && has_value) {
+            settings.samples = std::strtoull(argv[++i], nullptr, 10);
+        } else if ((option == "--warmups") && has_value) {
+            settings.warmups = std::strtoull(argv[++i], nullptr, 10);
+        } else if ((option == "--filter") && has_value) {
+            settings.filter = argv[++i];
+        } else if ((option == "--json") && has_value) {
+            settings.json = argv[++i];
+        } else if (!option.empty() && (option[0] != '-')) {
+            operations = std::strtoull(argv[i], nullptr, 10);
+        } else {
+            std::fprintf(stderr, "Usage: %s [operations] [--samples N] [--warmups N] "
+                                 "[--filter TEXT] [--json FILE]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    benchParse(operations);
+    benchParseDecimal(operations);
+    benchParseColumn(operations);
+    benchReadFile(operations);
+    benchStreams(operations);
+    benchOverflowPolicies(operations);
+
+    benchDivider<std::int8_t>(operations, "int8");
+    benchDivider<std::uint8_t>(operations, "uint8");
+    benchDivider<std::int16_t>(operations, "int16");
+    benchDivider<std::uint16_t>(operations, "uint16");
+    benchDivider<std::int32_t>(operations, "int32");
+    benchDivider<std::uint32_t>(operations, "uint32");
+    benchDivider<std::int64_t>(operations, "int64");
+    benchDivider<std::uint64_t>(operations, "uint64");
+
+    benchModular<std::uint32_t, std::uint64_t>(operations, "uint32", 4294967291u);
+    benchModular<std::uint64_t, unsigned __int128>(operations, "uint64", 0xFFFFFFFFFFFFFFC5ull);
+
+    for (bool skewed : { false, true }) {
+        benchFormatDecimal<std::uint8_t>(operations, "8-bit", skewed);
+        benchFormatDecimal<std::uint16_t>(operations, "16-bit", skewed);
+        benchFormatDecimal<std::uint32_t>(operations, "32-bit", skewed);
+        benchFormatDecimal<std::uint64_t>(operations, "64-bit", skewed);
+    }
+
+    benchFormatHexBinary(operations);
+    bench128(operations);
+    benchBits(operations);
+    benchMorton(operations);
+    benchMath(operations);
+    benchCompare(operations);
+
+    benchOperators<std::int8_t>(operations, "int8");
+    benchOperators<std::uint8_t>(operations, "uint8");
+    benchOperators<std::int16_t>(operations, "int16");
+    benchOperators<std::uint16_t>(operations, "uint16");
+    benchOperators<std::int32_t>(operations, "int32");
+    benchOperators<std::uint32_t>(operations, "uint32");
+    benchOperators<std::int64_t>(operations, "int64");
+    benchOperators<std::uint64_t>(operations, "uint64");
+
+    benchConversions<std::int8_t>(operations, "int8");
+    benchConversions<std::uint8_t>(operations, "uint8");
+    benchConversions<std::int16_t>(operations, "int16");
+    benchConversions<std::uint16_t>(operations, "uint16");
+    benchConversions<std::int32_t>(operations, "int32");
+    benchConversions<std::uint32_t>(operations, "uint32");
+    benchConversions<std::int64_t>(operations, "int64");
+    benchConversions<std::uint64_t>(operations, "uint64");
+
+    benchArray<std::int8_t>(operations, "int8");
+    benchArray<std::uint16_t>(operations, "uint16");
+    benchArray<std::int32_t>(operations, "int32");
+    benchArray<std::uint64_t>(operations, "uint64");
+
+    benchReduce<std::int8_t>(operations, "int8");
+    benchReduce<std::int16_t>(operations, "int16");
+    benchReduce<std::int32_t>(operations, "int32");
+    benchReduce<std::uint64_t>(operations, "uint64");
+
+    benchSort<std::int16_t>(operations, "int16", 1u << 20);
+    benchSort<std::int32_t>(operations, "int32", 1u << 20);
+    benchSort<std::int64_t>(operations, "int64", 1u << 16);
+    benchSort<std::int64_t>(operations, "int64", 1u << 20);
+    benchSort<std::uint64_t>(operations, "uint64", 1u << 22);
+
+    benchParallelSort<std::int32_t>(operations, "int32", 1u << 22);
+    benchParallelSort<std::uint64_t>(operations, "uint64", 1u << 22);
+    benchParallelSort<std::uint64_t>(operations, "uint64 <2^40", 1u << 22, 24);
+
+    if (settings.json && !writeJson(settings.json, operations)) {
+        std::fprintf(stderr, "Cannot write %s\n", settings.json);
+        return 1;
+    }
+    return 0;
+}
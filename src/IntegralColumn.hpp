@@ -0,0 +1,254 @@
+/*  Copyright(c) 2015, Rico Antonio Felix. All rights reserved.
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *      1. The origin of this software must not be misrepresented; you must not
+ *      claim that you wrote the original software. If you use this software
+ *      in a product, an acknowledgment in the product documentation would be
+ *      appreciated but is not required.
+ *
+ *      2. Altered source versions must be plainly marked as such, and must not
+ *      be misrepresented as being the original software.
+ *
+ *      3. This notice may not be removed or altered from any source
+ *      distribution.
+ */
+
+ /**
+  * @author Rico Antonio Felix <ricoantoniofelix@yahoo.com>
+  */
+
+#ifndef INTEGRAL_COLUMN_CSP_H__
+#define INTEGRAL_COLUMN_CSP_H__
+
+#include "Integral.hpp"
+
+#include <string_view>
+
+namespace compuSUAVE_Professional {
+
+/**
+ * @brief Outcome of parsing a delimited column
+ */
+struct ColumnParseResult {
+    std::size_t rows;   //< Number of tokens written to the output
+    std::size_t errors; //< Number of tokens that could not be parsed
+};
+
+//=========================================================================
+// Implementation Details
+//=========================================================================
+namespace detail {
+
+/*
+ * Signature of the kernels locating a delimiter in a block of 64 bytes, bit
+ * i of the result is set if the byte at offset i is the delimiter
+ */
+using DelimiterMaskKernel = std::uint64_t (*)(const char*, char) noexcept;
+
+inline std::uint64_t delimiterMaskScalar(const char* block,
+                                         const char delimiter) noexcept {
+    std::uint64_t mask = 0;
+    for (unsigned i = 0; i < 64; ++i) {
+        mask |= static_cast<std::uint64_t>(block[i] == delimiter) << i;
+    }
+    return mask;
+}
+
+#if defined(INTEGRAL_CSP_X86)
+__attribute__((target("sse2")))
+inline std::uint64_t delimiterMaskSse2(const char* block,
+                                       const char delimiter) noexcept {
+    const __m128i needle = _mm_set1_epi8(delimiter);
+    std::uint64_t mask = 0;
+    for (unsigned i = 0; i < 64; i += 16) {
+        const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i));
+        const unsigned found = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, needle)));
+        mask |= static_cast<std::uint64_t>(found) << i;
+    }
+    return mask;
+}
+
+__attribute__((target("avx2")))
+inline std::uint64_t delimiterMaskAvx2(const char* block,
+                                       const char delimiter) noexcept {
+    const __m256i needle = _mm256_set1_epi8(delimiter);
+    const __m256i low    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+    const __m256i high   = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32));
+    const unsigned found_low  = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(low, needle)));
+    const unsigned found_high = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(high, needle)));
+    return (static_cast<std::uint64_t>(found_high) << 32) | found_low;
+}
+
+__attribute__((target("avx512f,avx512bw")))
+inline std::uint64_t delimiterMaskAvx512(const char* block,
+                                         const char delimiter) noexcept {
+    const __m512i chars = _mm512_loadu_si512(block);
+    return _mm512_cmpeq_epi8_mask(chars, _mm512_set1_epi8(delimiter));
+}
+#endif
+
+/*
+ * Selects the widest delimiter search supported by the executing processor
+ */
+inline DelimiterMaskKernel delimiterMaskKernel() noexcept {
+#if defined(INTEGRAL_CSP_X86)
+    if (cpuFeatures().avx512bw) {
+        return delimiterMaskAvx512;
+    }
+    if (cpuFeatures().avx2) {
+        return delimiterMaskAvx2;
+    }
+    return delimiterMaskSse2;
+#else
+    return delimiterMaskScalar;
+#endif
+}
+
+/*
+ * Parses a single token in place, trailing whitespace such as the carriage
+ * return of CRLF input is accepted while any other leftover is an error
+ *
+ * Digits stop at the delimiter, so the token is parsed against the end of
+ * the whole buffer which lets the chunked decimal kernels run on short
+ * tokens; only a token that parses past its delimiter is parsed again
+ * within its bounds
+ */
+template<typename T>
+inline bool parseToken(const char* first, const char* end, const char* limit,
+                       T& value) noexcept {
+    value = T{};
+    ParseResult result = parseIntegral(first, limit, value);
+    if (result.ptr > end) {
+        value  = T{};
+        result = parseIntegral(first, end, value);
+    }
+    if (result.ec != std::errc{}) {
+        return false;
+    }
+    for (const char* it = result.ptr; it != end; ++it) {
+        if (!isSpace(*it)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Accumulates the per-row error bitmap one word at a time so that the caller
+ * does not need to clear it
+ */
+class ErrorBitmap final {
+
+public:
+
+    explicit ErrorBitmap(std::uint64_t* words) noexcept
+    : m_words{words}, m_word{0}, m_rows{0} {}
+
+    void record(const bool failed) noexcept {
+        m_word |= static_cast<std::uint64_t>(failed) << (m_rows % 64);
+        if ((++m_rows % 64) == 0) {
+            flush();
+        }
+    }
+
+    void finish() noexcept {
+        if ((m_rows % 64) != 0) {
+            flush();
+        }
+    }
+
+private:
+    void flush() noexcept {
+        if (m_words) {
+            *m_words++ = m_word;
+        }
+        m_word = 0;
+    }
+
+    std::uint64_t* m_words; //< Next word of the caller's bitmap
+    std::uint64_t  m_word;  //< Bits of the rows since the last flush
+    std::size_t    m_rows;  //< Number of rows recorded
+
+}; //< ErrorBitmap
+
+} //< namespace detail
+
+//=========================================================================
+// Column Parsing
+//=========================================================================
+
+/**
+ * @brief Parses every token of a delimited buffer into a contiguous array
+ *
+ * Delimiters are located 64 bytes at a time with the widest SIMD comparison
+ * the processor supports and every token is parsed where it lies, following
+ * the rules of the std::string constructor of Integral<T>. A token is an
+ * error if it holds no digits, anything but whitespace after its digits or
+ * a value out of the range of T; its element is then zero, or clamped for
+ * out of range values. A delimiter at the very end of the buffer does not
+ * start another row.
+ *
+ * @param buffer       Characters to parse
+ * @param delimiter    Character separating the tokens
+ * @param out          Destination with room for one element per delimiter
+ *                     plus one
+ * @param error_bitmap Optional destination with room for one bit per row,
+ *                     rounded up to whole 64-bit words; bit (row % 64) of
+ *                     word (row / 64) is set for every row in error
+ *
+ * @return Number of rows parsed and how many of them were in error
+ */
+template<typename T, typename Policy>
+ColumnParseResult parse_column(std::string_view buffer, const char delimiter,
+                               Integral<T, Policy>* out,
+                               std::uint64_t* error_bitmap = nullptr)
+                               noexcept {
+    const char* const first = buffer.data();
+    const char* const last  = first + buffer.size();
+
+    const detail::DelimiterMaskKernel delimiterMask = detail::delimiterMaskKernel();
+    detail::ErrorBitmap errors{error_bitmap};
+    ColumnParseResult   result{0, 0};
+
+    const char* token = first;
+    auto emit = [&](const char* end) {
+        T value{};
+        const bool failed = !detail::parseToken(token, end, last, value);
+        out[result.rows++] = Integral<T, Policy>{value};
+        result.errors += failed;
+        errors.record(failed);
+        token = end + 1;
+    };
+
+    const char* block = first;
+    for (; (last - block) >= 64; block += 64) {
+        for (std::uint64_t mask = delimiterMask(block, delimiter); mask != 0;
+             mask &= mask - 1) {
+            emit(block + __builtin_ctzll(mask));
+        }
+    }
+
+    for (; block != last; ++block) {
+        if (*block == delimiter) {
+            emit(block);
+        }
+    }
+
+    if (token < last) {
+        emit(last);
+    }
+
+    errors.finish();
+    return result;
+}
+
+} //< namespace compuSUAVE_Professional
+
+#endif //< INTEGRAL_COLUMN_CSP_H__
@@ -0,0 +1,328 @@
+/*  Copyright(c) 2015, Rico Antonio Felix. All rights reserved.
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *      1. The origin of this software must not be misrepresented; you must not
+ *      claim that you wrote the original software. If you use this software
+ *      in a product, an acknowledgment in the product documentation would be
+ *      appreciated but is not required.
+ *
+ *      2. Altered source versions must be plainly marked as such, and must not
+ *      be misrepresented as being the original software.
+ *
+ *      3. This notice may not be removed or altered from any source
+ *      distribution.
+ */
+
+ /**
+  * @author Rico Antonio Felix <ricoantoniofelix@yahoo.com>
+  */
+
+#ifndef INTEGRAL_READER_CSP_H__
+#define INTEGRAL_READER_CSP_H__
+
+#include "Integral.hpp"
+
+#include <cerrno>
+#include <iterator>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace compuSUAVE_Professional {
+
+/**
+ * @brief Streams Integral<T> values out of a text file without copying
+ *
+ * The file is memory mapped and walked once: tokens are separated by
+ * whitespace and parsed where they lie, following the rules of the
+ * std::string constructor of Integral<T>. A token that is not entirely a
+ * number yields a zero value and is counted as an error. The kernel is told
+ * that the mapping is read sequentially, the window ahead of the cursor is
+ * requested in advance and the window behind it is released.
+ */
+template<typename T, typename Policy = overflow::Wrapping>
+class IntegralReader final {
+
+public:
+
+    /**
+     * @brief Number of bytes prefetched ahead of and released behind the
+     *        cursor at a time
+     */
+    static constexpr std::size_t window = std::size_t{8} << 20;
+
+    /**
+     * @brief Input iterator over the values of the file
+     */
+    class iterator final {
+
+    public:
+
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = Integral<T, Policy>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const Integral<T, Policy>*;
+        using reference         = const Integral<T, Policy>&;
+
+        /**
+         * @brief Default constructor
+         *
+         * Creates the end iterator
+         */
+        iterator() noexcept
+        : m_reader{nullptr}, m_value{} {}
+
+        /**
+         * @brief Constructor to start iterating over the specified reader
+         *
+         * @param reader Reader to take the values from
+         */
+        explicit iterator(IntegralReader& reader) noexcept
+        : m_reader{&reader}, m_value{} {
+            ++*this;
+        }
+
+        reference operator *() const noexcept {
+            return m_value;
+        }
+
+        pointer operator ->() const noexcept {
+            return &m_value;
+        }
+
+        iterator& operator ++() noexcept {
+            if (!m_reader->next(m_value)) {
+                m_reader = nullptr;
+            }
+            return *this;
+        }
+
+        friend bool operator ==(const iterator& lhs,
+                                const iterator& rhs) noexcept {
+            return lhs.m_reader == rhs.m_reader;
+        }
+
+        friend bool operator !=(const iterator& lhs,
+                                const iterator& rhs) noexcept {
+            return !(lhs == rhs);
+        }
+
+    private:
+        IntegralReader*     m_reader; //< Source of the values, null at the end
+        Integral<T, Policy> m_value;  //< Current value
+
+    }; //< iterator
+
+    //=========================================================================
+    // Constructors
+    //=========================================================================
+
+    /**
+     * @brief Constructor to map the specified file
+     *
+     * @param path Path of the file to read
+     *
+     * @throw std::system_error If the file cannot be opened or mapped
+     */
+    explicit IntegralReader(const char* path)
+    : m_first{nullptr}, m_cursor{nullptr}, m_last{nullptr},
+      m_prefetched{nullptr}, m_released{nullptr}, m_errors{0} {
+
+        const int descriptor = ::open(path, O_RDONLY | O_CLOEXEC);
+        if (descriptor < 0) {
+            throw std::system_error{errno, std::generic_category(), path};
+        }
+
+        struct stat status;
+        if (::fstat(descriptor, &status) < 0) {
+            const int error = errno;
+            ::close(descriptor);
+            throw std::system_error{error, std::generic_category(), path};
+        }
+
+        // Empty files cannot be mapped and hold no values
+        const std::size_t size = static_cast<std::size_t>(status.st_size);
+        if (size != 0) {
+            void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE,
+                                   descriptor, 0);
+            if (mapping == MAP_FAILED) {
+                const int error = errno;
+                ::close(descriptor);
+                throw std::system_error{error, std::generic_category(), path};
+            }
+            ::madvise(mapping, size, MADV_SEQUENTIAL);
+
+            m_first  = static_cast<const char*>(mapping);
+            m_cursor = m_first;
+            m_last   = m_first + size;
+            m_prefetched = m_released = m_first;
+            prefetch();
+        }
+
+        // The mapping keeps the file alive
+        ::close(descriptor);
+    }
+
+    /**
+     * @brief Constructor to map the specified file
+     *
+     * @param path Path of the file to read
+     *
+     * @throw std::system_error If the file cannot be opened or mapped
+     */
+    explicit IntegralReader(const std::string& path)
+    : IntegralReader{path.c_str()} {}
+
+    IntegralReader(const IntegralReader&) = delete;
+    IntegralReader& operator =(const IntegralReader&) = delete;
+
+    //=========================================================================
+    // Destructor
+    //=========================================================================
+
+    /**
+     * @brief Destructor
+     *
+     * Unmaps the file
+     */
+    ~IntegralReader() {
+        if (m_first) {
+            ::munmap(const_cast<char*>(m_first),
+                     static_cast<std::size_t>(m_last - m_first));
+        }
+    }
+
+    //=========================================================================
+    // Reading Operations
+    //=========================================================================
+
+    /**
+     * @brief Get an iterator to the next value of the file
+     *
+     * Values taken through the iterator are consumed from the reader
+     */
+    iterator begin() noexcept {
+        return iterator{*this};
+    }
+
+    /**
+     * @brief Get the end iterator
+     */
+    iterator end() const noexcept {
+        return iterator{};
+    }
+
+    /**
+     * @brief Reads the next value of the file
+     *
+     * @param object Object to receive the value
+     *
+     * @return True if a value was read, false at the end of the file
+     */
+    bool next(Integral<T, Policy>& object) noexcept {
+        while ((m_cursor != m_last) && detail::isSpace(*m_cursor)) {
+            ++m_cursor;
+        }
+        if (m_cursor == m_last) {
+            return false;
+        }
+
+        T value{};
+        const ParseResult result = detail::parseIntegral(m_cursor, m_last, value);
+        m_cursor = result.ptr;
+
+        if ((result.ec != std::errc{}) ||
+            ((m_cursor != m_last) && !detail::isSpace(*m_cursor))) {
+            value = T{};
+            ++m_errors;
+            while ((m_cursor != m_last) && !detail::isSpace(*m_cursor)) {
+                ++m_cursor;
+            }
+        }
+
+        if (m_cursor >= m_prefetched) {
+            prefetch();
+        }
+
+        object = Integral<T, Policy>{value};
+        return true;
+    }
+
+    /**
+     * @brief Reads the next batch of values of the file
+     *
+     * @param out      Destination of the values
+     * @param capacity Maximum number of values to read
+     *
+     * @return Number of values read, zero at the end of the file
+     */
+    std::size_t read(Integral<T, Policy>* out,
+                     const std::size_t capacity) noexcept {
+        std::size_t count = 0;
+        while ((count != capacity) && next(out[count])) {
+            ++count;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Get the number of tokens which were not numbers so far
+     */
+    std::size_t errors() const noexcept {
+        return m_errors;
+    }
+
+//=========================================================================
+// Implementation Helper Method
+//=========================================================================
+private:
+    /*
+     * Requests the window ahead of the cursor and releases the whole windows
+     * that lie behind it
+     */
+    void prefetch() noexcept {
+        const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(m_first);
+
+        const std::size_t consumed = static_cast<std::size_t>(m_cursor - m_first);
+        const std::size_t behind   = (consumed / page) * page;
+        const std::size_t released = static_cast<std::size_t>(m_released - m_first);
+        if (behind >= released + window) {
+            ::madvise(reinterpret_cast<void*>(base + released), behind - released,
+                      MADV_DONTNEED);
+            m_released = m_first + behind;
+        }
+
+        const std::size_t start = (static_cast<std::size_t>(m_prefetched - m_first) / page) * page;
+        const std::size_t size  = static_cast<std::size_t>(m_last - m_first);
+        const std::size_t ahead = std::min(size - start, 2 * window);
+        ::madvise(reinterpret_cast<void*>(base + start), ahead, MADV_WILLNEED);
+        m_prefetched = std::min(m_cursor + window, m_last);
+    }
+
+//=========================================================================
+// Implementation Details
+//=========================================================================
+private:
+    const char* m_first;      //< Beginning of the mapping
+    const char* m_cursor;     //< Next character to tokenize
+    const char* m_last;       //< End of the mapping
+    const char* m_prefetched; //< Position that triggers the next prefetch
+    const char* m_released;   //< End of the range already released
+    std::size_t m_errors;     //< Number of tokens which were not numbers
+
+}; //< IntegralReader<T>
+
+} //< namespace compuSUAVE_Professional
+
+#endif //< INTEGRAL_READER_CSP_H__
@@ -0,0 +1,569 @@
+/*  Copyright(c) 2015, Rico Antonio Felix. All rights reserved.
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *      1. The origin of this software must not be misrepresented; you must not
+ *      claim that you wrote the original software. If you use this software
+ *      in a product, an acknowledgment in the product documentation would be
+ *      appreciated but is not required.
+ *
+ *      2. Altered source versions must be plainly marked as such, and must not
+ *      be misrepresented as being the original software.
+ *
+ *      3. This notice may not be removed or altered from any source
+ *      distribution.
+ */
+
+ /**
+  * @author Rico Antonio Felix <ricoantoniofelix@yahoo.com>
+  */
+
+#ifndef INTEGRAL_REDUCE_CSP_H__
+#define INTEGRAL_REDUCE_CSP_H__
+
+#include "Integral.hpp"
+#include "IntegralArray.hpp"
+
+#include <vector>
+
+namespace compuSUAVE_Professional {
+
+//=========================================================================
+// Implementation Details
+//=========================================================================
+namespace detail {
+
+/*
+ * Lanes accumulating the sums of 8-bit to 32-bit elements and the type of
+ * the total, wide enough that no sum of an addressable range overflows
+ */
+template<typename T>
+using SumLane = std::conditional_t<
+    (sizeof(T) <= 2),
+    std::conditional_t<IntegralTraits<T>::is_signed,
+                       std::int32_t, std::uint32_t>,
+    std::conditional_t<IntegralTraits<T>::is_signed,
+                       std::int64_t, std::uint64_t>>;
+
+#if defined(__SIZEOF_INT128__)
+template<typename T>
+using SumTotal = std::conditional_t<
+    (sizeof(T) == 8),
+    std::conditional_t<IntegralTraits<T>::is_signed, Int128, UInt128>,
+    std::conditional_t<IntegralTraits<T>::is_signed,
+                       long long, unsigned long long>>;
+#else
+template<typename T>
+using SumTotal = std::conditional_t<IntegralTraits<T>::is_signed,
+                                    long long, unsigned long long>;
+#endif
+
+/*
+ * Sums of adjacent pairs of lanes into lanes of twice their width, the
+ * halves of every wide lane are extended with shifts that stay within the
+ * lane rather than the shuffles the compiler emits for conversions
+ */
+template<typename Lane, typename Narrow, typename Wide>
+__attribute__((always_inline))
+inline void pairSums(const Narrow& narrow, Wide& sums) noexcept {
+    using Unsigned = typename SimdVector<std::make_unsigned_t<Lane>,
+                                         sizeof(Wide)>::type;
+    constexpr int half = sizeof(Lane) * 4;
+
+    const Wide wide = (Wide)narrow;
+    sums  = (Wide)((Unsigned)wide << half) >> half;
+    sums += wide >> half;
+}
+
+template<typename Lane, typename V>
+__attribute__((always_inline))
+inline void pairSums(const V& narrow, V& sums) noexcept {
+    sums = narrow;
+}
+
+/*
+ * Reduction kernels, each runs over vectors of the specified width and
+ * finishes the elements that do not fill one
+ */
+struct SumKernel {
+
+    template<std::size_t Bytes, typename T, typename Policy>
+    __attribute__((always_inline))
+    static SumTotal<T> run(const Integral<T, Policy>* data,
+                           const std::size_t count) noexcept {
+        using Width = std::integral_constant<std::size_t,
+                                             (sizeof(T) < 4) ? 2 : sizeof(T)>;
+        return run<Bytes>(data, count, Width{});
+    }
+
+    /*
+     * Widening sum of 8-bit and 16-bit elements, which reach lanes of 32
+     * bits as sums of pairs of lanes; the four independent accumulators
+     * that hide the latency of the additions are added to the total every
+     * 2^12 vectors, before any lane can overflow
+     */
+    template<std::size_t Bytes, typename T, typename Policy>
+    __attribute__((always_inline))
+    static SumTotal<T> run(const Integral<T, Policy>* data,
+                           const std::size_t count,
+                           std::integral_constant<std::size_t, 2>) noexcept {
+        using Lane = SumLane<T>;
+        using Pair = std::conditional_t<
+            IntegralTraits<T>::is_signed, std::int16_t, std::uint16_t>;
+        constexpr std::size_t lanes = Bytes / sizeof(T);
+        constexpr std::size_t step  = 4 * lanes;
+        constexpr std::size_t flush = (std::size_t{1} << 12) * step;
+        using V = typename SimdVector<T, Bytes>::type;
+        using P = typename SimdVector<Pair, Bytes>::type;
+        using A = typename SimdVector<Lane, Bytes>::type;
+
+        SumTotal<T> total = 0;
+        std::size_t i = 0;
+        while ((count - i) >= step) {
+            const std::size_t block = ((count - i) / step) * step;
+            const std::size_t end   = i + ((block < flush) ? block : flush);
+
+            A sum0{}, sum1{}, sum2{}, sum3{};
+            for (; i < end; i += step) {
+                V v0, v1, v2, v3;
+                P p0, p1, p2, p3;
+                A q0, q1, q2, q3;
+                loadVector(v0, data + i);
+                loadVector(v1, data + i + lanes);
+                loadVector(v2, data + i + 2 * lanes);
+                loadVector(v3, data + i + 3 * lanes);
+                pairSums<Pair>(v0, p0);
+                pairSums<Pair>(v1, p1);
+                pairSums<Pair>(v2, p2);
+                pairSums<Pair>(v3, p3);
+                pairSums<Lane>(p0, q0);
+                pairSums<Lane>(p1, q1);
+                pairSums<Lane>(p2, q2);
+                pairSums<Lane>(p3, q3);
+                sum0 += q0;
+                sum1 += q1;
+                sum2 += q2;
+                sum3 += q3;
+            }
+            sum0 += sum1;
+            sum2 += sum3;
+            for (std::size_t lane = 0; lane < Bytes / sizeof(Lane); ++lane) {
+                total += sum0[lane];
+                total += sum2[lane];
+            }
+        }
+        for (; i < count; ++i) {
+            total += static_cast<T>(data[i]);
+        }
+        return total;
+    }
+
+    /*
+     * Widening sum of 32-bit elements, every accumulator fills a whole
+     * vector of 64-bit lanes converted from the elements of a half width
+     * load, and four independent ones hide the latency of the additions
+     */
+    template<std::size_t Bytes, typename T, typename Policy>
+    __attribute__((always_inline))
+    static SumTotal<T> run(const Integral<T, Policy>* data,
+                           const std::size_t count,
+                           std::integral_constant<std::size_t, 4>) noexcept {
+        using Lane = SumLane<T>;
+        constexpr std::size_t lanes = Bytes / sizeof(Lane);
+        constexpr std::size_t step  = 4 * lanes;
+        using H = typename SimdVector<T, lanes * sizeof(T)>::type;
+        using A = typename SimdVector<Lane, Bytes>::type;
+
+        A sum0{}, sum1{}, sum2{}, sum3{};
+        std::size_t i = 0;
+        for (; (i + step) <= count; i += step) {
+            H h0, h1, h2, h3;
+            loadVector(h0, data + i);
+            loadVector(h1, data + i + lanes);
+            loadVector(h2, data + i + 2 * lanes);
+            loadVector(h3, data + i + 3 * lanes);
+            sum0 += __builtin_convertvector(h0, A);
+            sum1 += __builtin_convertvector(h1, A);
+            sum2 += __builtin_convertvector(h2, A);
+            sum3 += __builtin_convertvector(h3, A);
+        }
+        sum0 += sum1;
+        sum2 += sum3;
+        sum0 += sum2;
+
+        SumTotal<T> total = 0;
+        for (std::size_t lane = 0; lane < lanes; ++lane) {
+            total += sum0[lane];
+        }
+        for (; i < count; ++i) {
+            total += static_cast<T>(data[i]);
+        }
+        return total;
+    }
+
+    /*
+     * Widening sum of 64-bit elements, lanes keep the low halves of their
+     * sums and count the carries out of them, together with the sign
+     * extension of signed elements, in lanes holding the high halves
+     */
+    template<std::size_t Bytes, typename T, typename Policy>
+    __attribute__((always_inline))
+    static SumTotal<T> run(const Integral<T, Policy>* data,
+                           const std::size_t count,
+                           std::integral_constant<std::size_t, 8>) noexcept {
+        using U = MakeUnsigned<T>;
+        using S = std::make_signed_t<T>;
+        constexpr std::size_t lanes = Bytes / sizeof(T);
+        constexpr std::size_t step  = 2 * lanes;
+        using V  = typename SimdVector<U, Bytes>::type;
+        using VS = typename SimdVector<S, Bytes>::type;
+
+        V low0{}, low1{}, high0{}, high1{};
+        std::size_t i = 0;
+        for (; (i + step) <= count; i += step) {
+            V v0, v1;
+            loadVector(v0, data + i);
+            loadVector(v1, data + i + lanes);
+
+            const V sum0 = low0 + v0;
+            const V sum1 = low1 + v1;
+            high0 -= (V)(sum0 < low0);
+            high1 -= (V)(sum1 < low1);
+            if (IntegralTraits<T>::is_signed) {
+                high0 += (V)((VS)v0 < VS{});
+                high1 += (V)((VS)v1 < VS{});
+            }
+            low0 = sum0;
+            low1 = sum1;
+        }
+
+        /* without 128-bit integers the total wraps to its low half */
+        using W = MakeUnsigned<SumTotal<T>>;
+        W total = 0;
+        for (std::size_t lane = 0; lane < lanes; ++lane) {
+            total += (static_cast<W>(high0[lane]) << 32 << 32) | low0[lane];
+            total += (static_cast<W>(high1[lane]) << 32 << 32) | low1[lane];
+        }
+        for (; i < count; ++i) {
+            total += static_cast<W>(static_cast<SumTotal<T>>(
+                         static_cast<T>(data[i])));
+        }
+        return static_cast<SumTotal<T>>(total);
+    }
+};
+
+/*
+ * Least or greatest element, four independent accumulators of lanes that
+ * start from the identity of the operation
+ */
+template<typename Operation>
+struct ExtremeKernel {
+
+    template<std::size_t Bytes, typename T, typename Policy>
+    __attribute__((always_inline))
+    static T run(const Integral<T, Policy>* data, const std::size_t count,
+                 const T identity) noexcept {
+        constexpr std::size_t lanes = Bytes / sizeof(T);
+        constexpr std::size_t step  = 4 * lanes;
+        using V = typename SimdVector<T, Bytes>::type;
+
+        V best0;
+        for (std::size_t lane = 0; lane < lanes; ++lane) {
+            best0[lane] = identity;
+        }
+        V best1 = best0, best2 = best0, best3 = best0;
+
+        std::size_t i = 0;
+        for (; (i + step) <= count; i += step) {
+            V v0, v1, v2, v3;
+            loadVector(v0, data + i);
+            loadVector(v1, data + i + lanes);
+            loadVector(v2, data + i + 2 * lanes);
+            loadVector(v3, data + i + 3 * lanes);
+            Operation::apply(best0, v0, best0);
+            Operation::apply(best1, v1, best1);
+            Operation::apply(best2, v2, best2);
+            Operation::apply(best3, v3, best3);
+        }
+        Operation::apply(best0, best1, best0);
+        Operation::apply(best2, best3, best2);
+        Operation::apply(best0, best2, best0);
+
+        T best = identity;
+        for (std::size_t lane = 0; lane < lanes; ++lane) {
+            const T candidate = best0[lane];
+            Operation::apply(best, candidate, best);
+        }
+        for (; i < count; ++i) {
+            const T candidate = static_cast<T>(data[i]);
+            Operation::apply(best, candidate, best);
+        }
+        return best;
+    }
+};
+
+/*
+ * Number of set bits of a range of bytes, counted in place for every byte
+ * by the SWAR reduction on 64-bit lanes; the byte counts, at most 8 per
+ * vector, accumulate in their bytes for 31 vectors before they are widened
+ * into the lane totals
+ */
+struct PopcountKernel {
+
+    template<std::size_t Bytes>
+    __attribute__((always_inline))
+    static std::uint64_t run(const unsigned char* bytes,
+                             const std::size_t count) noexcept {
+        using V = typename SimdVector<std::uint64_t, Bytes>::type;
+        constexpr std::uint64_t ones  = 0x0101010101010101ull;
+        constexpr std::size_t   burst = 31 * Bytes;
+
+        V totals{};
+        std::size_t i = 0;
+        while ((count - i) >= Bytes) {
+            const std::size_t block = ((count - i) / Bytes) * Bytes;
+            const std::size_t end   = i + ((block < burst) ? block : burst);
+
+            V counts{};
+            for (; i < end; i += Bytes) {
+                V v;
+                loadVector(v, bytes + i);
+                v = v - ((v >> 1) & (0x55 * ones));
+                v = (v & (0x33 * ones)) + ((v >> 2) & (0x33 * ones));
+                counts += (v + (v >> 4)) & (0x0F * ones);
+            }
+            counts = (counts & 0x00FF00FF00FF00FFull) +
+                     ((counts >> 8) & 0x00FF00FF00FF00FFull);
+            counts = (counts & 0x0000FFFF0000FFFFull) +
+                     ((counts >> 16) & 0x0000FFFF0000FFFFull);
+            totals += (counts & 0xFFFFFFFFull) + (counts >> 32);
+        }
+
+        std::uint64_t total = 0;
+        for (std::size_t lane = 0; lane < Bytes / 8; ++lane) {
+            total += totals[lane];
+        }
+        for (; i < count; ++i) {
+            total += static_cast<std::uint64_t>(__builtin_popcount(bytes[i]));
+        }
+        return total;
+    }
+};
+
+#if defined(INTEGRAL_CSP_X86)
+template<typename Kernel, typename... Arguments>
+__attribute__((target("sse2")))
+auto reduceSse2(const Arguments... arguments) noexcept {
+    return Kernel::template run<16>(arguments...);
+}
+
+template<typename Kernel, typename... Arguments>
+__attribute__((target("avx2")))
+auto reduceAvx2(const Arguments... arguments) noexcept {
+    return Kernel::template run<32>(arguments...);
+}
+
+template<typename Kernel, typename... Arguments>
+__attribute__((target("avx512f,avx512bw")))
+auto reduceAvx512(const Arguments... arguments) noexcept {
+    return Kernel::template run<64>(arguments...);
+}
+#endif
+
+/*
+ * Runs the reduction with the widest vectors supported by the executing
+ * processor, other targets lower the generic vectors of 16 bytes to their
+ * own instructions
+ */
+template<typename Kernel, typename... Arguments>
+inline auto reduceIntegrals(const Arguments... arguments) noexcept {
+#if defined(INTEGRAL_CSP_X86)
+    if (cpuFeatures().avx512bw) {
+        return reduceAvx512<Kernel>(arguments...);
+    }
+    if (cpuFeatures().avx2) {
+        return reduceAvx2<Kernel>(arguments...);
+    }
+    return reduceSse2<Kernel>(arguments...);
+#else
+    return Kernel::template run<16>(arguments...);
+#endif
+}
+
+/*
+ * Counts of one digit accumulated in interleaved tables, consecutive
+ * elements with the same digit increment different counters instead of
+ * waiting on the store of the previous increment
+ */
+template<typename T, typename Policy>
+inline void histogramTables(const Integral<T, Policy>* first,
+                            const Integral<T, Policy>* last,
+                            const unsigned shift, const MakeUnsigned<T> mask,
+                            std::uint32_t* tables, const std::size_t buckets)
+                            noexcept {
+    using U = MakeUnsigned<T>;
+    const auto digit = [&](const Integral<T, Policy>& element) {
+        return static_cast<std::size_t>(
+            (static_cast<U>(static_cast<T>(element)) >> shift) & mask);
+    };
+
+    for (; (last - first) >= 4; first += 4) {
+        ++tables[digit(first[0])];
+        ++tables[buckets + digit(first[1])];
+        ++tables[2 * buckets + digit(first[2])];
+        ++tables[3 * buckets + digit(first[3])];
+    }
+    for (; first != last; ++first) {
+        ++tables[digit(*first)];
+    }
+}
+
+} //< namespace detail
+
+//=========================================================================
+// Reductions
+//=========================================================================
+
+/**
+ * @brief Type of the sums of ranges of Integral<T>, 64 bits for elements
+ *        of up to 32 bits and 128 bits for 64-bit elements where the
+ *        compiler provides them
+ */
+template<typename T>
+using IntegralSum = Integral<detail::SumTotal<T>>;
+
+/**
+ * @brief Sum of every element of a range, accumulated in wider lanes so
+ *        that it never overflows regardless of the policy of the elements
+ *
+ * @param first Pointer to the first element
+ * @param last  Pointer past the last element
+ *
+ * @return Exact sum of the elements, zero for an empty range
+ */
+template<typename T, typename Policy>
+inline IntegralSum<T> reduce_sum(const Integral<T, Policy>* first,
+                                 const Integral<T, Policy>* last) noexcept {
+    static_assert(sizeof(T) <= 8,
+                  "reduce_sum is limited to elements of up to 64 bits");
+
+    return IntegralSum<T>{detail::reduceIntegrals<detail::SumKernel>(
+        first, static_cast<std::size_t>(last - first))};
+}
+
+/**
+ * @brief Least element of a range
+ *
+ * @param first Pointer to the first element
+ * @param last  Pointer past the last element
+ *
+ * @return Least element, Integral<T, Policy>::max() for an empty range
+ */
+template<typename T, typename Policy>
+inline Integral<T, Policy> reduce_min(const Integral<T, Policy>* first,
+                                      const Integral<T, Policy>* last)
+                                      noexcept {
+    return Integral<T, Policy>{
+        detail::reduceIntegrals<detail::ExtremeKernel<detail::MinLanes>>(
+            first, static_cast<std::size_t>(last - first),
+            detail::IntegralTraits<T>::max())};
+}
+
+/**
+ * @brief Greatest element of a range
+ *
+ * @param first Pointer to the first element
+ * @param last  Pointer past the last element
+ *
+ * @return Greatest element, Integral<T, Policy>::min() for an empty range
+ */
+template<typename T, typename Policy>
+inline Integral<T, Policy> reduce_max(const Integral<T, Policy>* first,
+                                      const Integral<T, Policy>* last)
+                                      noexcept {
+    return Integral<T, Policy>{
+        detail::reduceIntegrals<detail::ExtremeKernel<detail::MaxLanes>>(
+            first, static_cast<std::size_t>(last - first),
+            detail::IntegralTraits<T>::min())};
+}
+
+/**
+ * @brief Total number of set bits of every element of a range
+ *
+ * @param first Pointer to the first element
+ * @param last  Pointer past the last element
+ *
+ * @return Sum of the popcount() of the elements
+ */
+template<typename T, typename Policy>
+inline std::uint64_t reduce_popcount(const Integral<T, Policy>* first,
+                                     const Integral<T, Policy>* last)
+                                     noexcept {
+    return detail::reduceIntegrals<detail::PopcountKernel>(
+        reinterpret_cast<const unsigned char*>(first),
+        static_cast<std::size_t>(last - first) * sizeof(T));
+}
+
+/**
+ * @brief Counts the occurrences of every value of one digit of the
+ *        elements of a range, the digit of the radix sorts
+ *
+ * The digit is taken from the bit pattern of the elements, as their
+ * unsigned counterparts hold it. Counts are added to the specified array
+ * rather than replacing it, so the histograms of several ranges can be
+ * accumulated into one.
+ *
+ * @param first  Pointer to the first element
+ * @param last   Pointer past the last element
+ * @param shift  Position of the lowest bit of the digit
+ * @param bits   Width of the digit, 1 to 16 bits
+ * @param counts Array of (1 << bits) counts
+ */
+template<typename T, typename Policy>
+inline void radix_histogram(const Integral<T, Policy>* first,
+                            const Integral<T, Policy>* last,
+                            const unsigned shift, const unsigned bits,
+                            std::size_t* counts) {
+    using U = detail::MakeUnsigned<T>;
+    const std::size_t buckets = std::size_t{1} << bits;
+    const U mask = static_cast<U>(buckets - 1);
+
+    /* four tables only pay off while they all stay in the first level cache */
+    const std::size_t tables = (bits <= 8) ? 4 : 1;
+    const std::ptrdiff_t chunk = std::ptrdiff_t{1} << 30;
+    std::vector<std::uint32_t> table(tables * buckets);
+
+    while (first != last) {
+        const Integral<T, Policy>* end = ((last - first) > chunk)
+                                         ? first + chunk : last;
+        if (tables == 4) {
+            detail::histogramTables(first, end, shift, mask, table.data(),
+                                    buckets);
+        } else {
+            for (; first != end; ++first) {
+                ++table[(static_cast<U>(static_cast<T>(*first)) >> shift) &
+                        mask];
+            }
+        }
+        first = end;
+
+        for (std::size_t bucket = 0; bucket < buckets; ++bucket) {
+            std::size_t count = 0;
+            for (std::size_t index = 0; index < tables; ++index) {
+                count += table[index * buckets + bucket];
+                table[index * buckets + bucket] = 0;
+            }
+            counts[bucket] += count;
+        }
+    }
+}
+
+} //< namespace compuSUAVE_Professional
+
+#endif //< INTEGRAL_REDUCE_CSP_H__
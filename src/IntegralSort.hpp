@@ -0,0 +1,464 @@
+/*  Copyright(c) 2015, Rico Antonio Felix. All rights reserved.
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *      1. The origin of this software must not be misrepresented; you must not
+ *      claim that you wrote the original software. If you use this software
+ *      in a product, an acknowledgment in the product documentation would be
+ *      appreciated but is not required.
+ *
+ *      2. Altered source versions must be plainly marked as such, and must not
+ *      be misrepresented as being the original software.
+ *
+ *      3. This notice may not be removed or altered from any source
+ *      distribution.
+ */
+
+ /**
+  * @author Rico Antonio Felix <ricoantoniofelix@yahoo.com>
+  */
+
+#ifndef INTEGRAL_SORT_CSP_H__
+#define INTEGRAL_SORT_CSP_H__
+
+#include "Integral.hpp"
+#include "IntegralReduce.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <new>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+namespace compuSUAVE_Professional {
+
+//=========================================================================
+// Implementation Details
+//=========================================================================
+namespace detail {
+
+/*
+ * Unsigned keys ordered as the values of T, the sign bit of signed types
+ * is flipped so that negative values precede the positive ones
+ */
+template<typename T>
+struct RadixKey {
+    using type = MakeUnsigned<T>;
+
+    static constexpr type flip =
+        IntegralTraits<T>::is_signed
+        ? static_cast<type>(type{1} << (sizeof(T) * 8 - 1)) : type{0};
+
+    template<typename Policy>
+    static type of(const Integral<T, Policy>& element) noexcept {
+        return static_cast<type>(static_cast<type>(static_cast<T>(element)) ^
+                                 flip);
+    }
+};
+
+/*
+ * Digit width of the passes for the width of T; 64-bit keys trade passes
+ * for buckets as the range grows, starting from 8-bit digits whose
+ * histograms are cheap to prefix for small ranges up to 16-bit digits that
+ * take four passes over the largest ones
+ */
+template<typename T>
+constexpr unsigned radixDigitBits(const std::size_t count) noexcept {
+    return (sizeof(T) <= 2) ? 8
+         : (sizeof(T) == 4) ? 11
+         : (count < (std::size_t{1} << 16)) ? 8
+         : (count < (std::size_t{1} << 24)) ? 11 : 16;
+}
+
+/*
+ * Ranges of at most this many elements are insertion sorted, below it the
+ * histograms cost more than the comparisons they save
+ */
+constexpr std::size_t radixInsertionLimit = 64;
+
+template<typename T, typename Policy>
+inline void insertionSort(Integral<T, Policy>* first,
+                          Integral<T, Policy>* last) noexcept {
+    if (first == last) {
+        return;
+    }
+    for (Integral<T, Policy>* current = first + 1; current != last; ++current) {
+        const Integral<T, Policy> element = *current;
+        const T value = static_cast<T>(element);
+
+        Integral<T, Policy>* hole = current;
+        for (; (hole != first) && (value < static_cast<T>(hole[-1])); --hole) {
+            *hole = hole[-1];
+        }
+        *hole = element;
+    }
+}
+
+/*
+ * Histogram of one digit of the keys, counted by radix_histogram on the bit
+ * pattern of the elements; the buckets of the digit holding the sign bit
+ * are exchanged around it, before and after, as the keys flip that bit
+ */
+template<typename T, typename Policy>
+inline void radixHistogram(const Integral<T, Policy>* first,
+                           const Integral<T, Policy>* last,
+                           const unsigned shift, const unsigned bits,
+                           std::size_t* counts) {
+    const std::size_t buckets = std::size_t{1} << bits;
+    const std::size_t flipped =
+        static_cast<std::size_t>(RadixKey<T>::flip >> shift) & (buckets - 1);
+
+    const auto exchange = [&] {
+        for (std::size_t bucket = 0; bucket < buckets; ++bucket) {
+            if (bucket < (bucket ^ flipped)) {
+                std::swap(counts[bucket], counts[bucket ^ flipped]);
+            }
+        }
+    };
+
+    exchange();
+    radix_histogram(first, last, shift, bits, counts);
+    exchange();
+}
+
+/*
+ * Moves every element to the position its digit is assigned, in the order
+ * the elements appear, which keeps every pass stable; the digit is taken
+ * from the keys less the specified least key, zero for the passes
+ */
+template<typename T, typename Policy>
+inline void radixScatter(const Integral<T, Policy>* first,
+                         const Integral<T, Policy>* last,
+                         Integral<T, Policy>* destination,
+                         const unsigned shift, const unsigned bits,
+                         std::size_t* offsets,
+                         const typename RadixKey<T>::type least = 0)
+                         noexcept {
+    using Key = RadixKey<T>;
+    const typename Key::type mask =
+        static_cast<typename Key::type>((std::size_t{1} << bits) - 1);
+
+    for (; first != last; ++first) {
+        const std::size_t digit = static_cast<typename Key::type>(
+            static_cast<typename Key::type>(Key::of(*first) - least) >>
+            shift) & mask;
+        destination[offsets[digit]++] = *first;
+    }
+}
+
+/*
+ * Least significant digit radix sort of the elements with the specified
+ * histograms of all of their digits, alternating between the elements and
+ * the buffer; passes whose digit is the same for every element are skipped
+ *
+ * Returns whether the sorted elements ended up in the buffer
+ */
+template<typename T, typename Policy>
+inline bool radixSortPasses(Integral<T, Policy>* elements,
+                            Integral<T, Policy>* buffer,
+                            const std::size_t count, const unsigned bits,
+                            const unsigned passes, std::size_t* counts)
+                            noexcept {
+    const std::size_t buckets = std::size_t{1} << bits;
+    Integral<T, Policy>* source      = elements;
+    Integral<T, Policy>* destination = buffer;
+
+    for (unsigned pass = 0; pass < passes; ++pass) {
+        std::size_t* offsets = counts + pass * buckets;
+
+        bool uniform = false;
+        std::size_t total = 0;
+        for (std::size_t bucket = 0; bucket < buckets; ++bucket) {
+            const std::size_t size = offsets[bucket];
+            uniform |= (size == count);
+            offsets[bucket] = total;
+            total += size;
+        }
+        if (uniform) {
+            continue;
+        }
+
+        radixScatter(source, source + count, destination, pass * bits, bits,
+                     offsets);
+
+        Integral<T, Policy>* swap = source;
+        source      = destination;
+        destination = swap;
+    }
+    return source == buffer;
+}
+
+/*
+ * Uninitialized storage for the elements of the scatter passes, every
+ * element is written before it is read
+ */
+struct RadixBufferDeleter {
+    void operator ()(void* storage) const noexcept {
+        ::operator delete(storage);
+    }
+};
+
+template<typename T, typename Policy>
+using RadixBuffer = std::unique_ptr<Integral<T, Policy>[], RadixBufferDeleter>;
+
+template<typename T, typename Policy>
+inline RadixBuffer<T, Policy> radixBuffer(const std::size_t count) {
+    return RadixBuffer<T, Policy>{static_cast<Integral<T, Policy>*>(
+        ::operator new(count * sizeof(Integral<T, Policy>)))};
+}
+
+/*
+ * Sorts the elements with scratch storage of the same size, returns
+ * whether the sorted elements ended up in the scratch storage
+ */
+template<typename T, typename Policy>
+inline bool radixSort(Integral<T, Policy>* elements,
+                      Integral<T, Policy>* scratch, const std::size_t count) {
+    if (count <= radixInsertionLimit) {
+        insertionSort(elements, elements + count);
+        return false;
+    }
+
+    const unsigned bits   = radixDigitBits<T>(count);
+    const unsigned passes = (sizeof(T) * 8 + bits - 1) / bits;
+
+    std::vector<std::size_t> counts(passes << bits);
+    for (unsigned pass = 0; pass < passes; ++pass) {
+        radixHistogram(elements, elements + count, pass * bits, bits,
+                       counts.data() + (std::size_t{pass} << bits));
+    }
+    return radixSortPasses(elements, scratch, count, bits, passes,
+                           counts.data());
+}
+
+/*
+ * Position of the digit a parallel sort splits on, the highest digit of
+ * the specified width that holds a bit of the span between the least and
+ * greatest keys, or the lowest digit for narrower spans; keys clustered
+ * anywhere in the range of T then still spread over the buckets
+ */
+template<typename T>
+inline unsigned radixSplitShift(const typename RadixKey<T>::type span,
+                                const unsigned bits) noexcept {
+    using Wide = std::conditional_t<(sizeof(T) > 8),
+                                    FixedWidth<typename RadixKey<T>::type>,
+                                    std::uint64_t>;
+    const unsigned width = static_cast<unsigned>(
+        sizeof(Wide) * 8 - leadingZeros(static_cast<Wide>(span)));
+    return (width > bits) ? width - bits : 0;
+}
+
+/*
+ * Histogram of the digit a parallel sort splits on, taken from the keys
+ * less the least key so that it orders the elements of the whole range
+ */
+template<typename T, typename Policy>
+inline void radixSplitHistogram(const Integral<T, Policy>* first,
+                                const Integral<T, Policy>* last,
+                                const typename RadixKey<T>::type least,
+                                const unsigned shift, std::size_t* counts)
+                                noexcept {
+    using Key = RadixKey<T>;
+    for (; first != last; ++first) {
+        ++counts[static_cast<typename Key::type>(Key::of(*first) - least) >>
+                 shift];
+    }
+}
+
+/*
+ * Ranges give every thread of a parallel sort at least this many elements,
+ * fewer do not repay starting the thread
+ */
+constexpr std::size_t parallelSortGrain = std::size_t{1} << 14;
+
+/*
+ * Runs the function for every task index, each on its own thread and the
+ * first on the calling thread; tasks no thread could be started for run
+ * on the calling thread as well, and the first exception thrown by any
+ * task is rethrown once every task has finished
+ */
+template<typename Function>
+inline void parallelFor(const std::size_t tasks, const Function& function) {
+    std::vector<std::exception_ptr> errors(tasks);
+    const auto run = [&](const std::size_t task) {
+        try {
+            function(task);
+        } catch (...) {
+            errors[task] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    std::size_t started = 1;
+    try {
+        workers.reserve(tasks - 1);
+        for (; started < tasks; ++started) {
+            workers.emplace_back(run, started);
+        }
+    } catch (...) {
+        /* the remaining tasks run below */
+    }
+
+    run(0);
+    for (std::size_t task = started; task < tasks; ++task) {
+        run(task);
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    for (const std::exception_ptr& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+} //< namespace detail
+
+//=========================================================================
+// Sorting
+//=========================================================================
+
+/**
+ * @brief Sorts a range of Integral objects in ascending order of their
+ *        values with a least significant digit radix sort
+ *
+ * The digits are 8 bits wide for elements of up to 16 bits and 11 bits for
+ * 32-bit elements. 64-bit elements take 8-bit digits below 2^16 elements,
+ * 11-bit digits below 2^24 elements and 16-bit digits beyond.
+ *
+ * Signed values are ordered by flipping their sign bit, passes whose digit
+ * is the same for every element are skipped and ranges of up to 64
+ * elements are insertion sorted instead. The sort is stable and allocates
+ * a buffer as large as the range.
+ *
+ * @param first Pointer to the first element
+ * @param last  Pointer past the last element
+ */
+template<typename T, typename Policy>
+inline void integral_sort(Integral<T, Policy>* first,
+                          Integral<T, Policy>* last) {
+    const std::size_t count = static_cast<std::size_t>(last - first);
+    if (count <= detail::radixInsertionLimit) {
+        detail::insertionSort(first, last);
+        return;
+    }
+
+    auto buffer = detail::radixBuffer<T, Policy>(count);
+    if (detail::radixSort(first, buffer.get(), count)) {
+        std::copy(buffer.get(), buffer.get() + count, first);
+    }
+}
+
+/**
+ * @brief Sorts a range of Integral objects in ascending order of their
+ *        values on several threads
+ *
+ * The threads find the least and greatest keys of equal parts of the
+ * range, count the top 8 bits of the distance of their keys from the
+ * least key of the range, so that values clustered anywhere in the range
+ * of T still split, and scatter their parts into one bucket per digit, in
+ * the order of the parts. They then take the buckets largest first and
+ * radix sort each one on its own. Every thread gets at least 16384
+ * elements, so fewer threads are used for smaller ranges; ranges too
+ * small for two threads, and 8-bit elements, are sorted on the calling
+ * thread. Keys sharing that digit leave their bucket to a single thread.
+ *
+ * The result is the same for any number of threads.
+ *
+ * @param first   Pointer to the first element
+ * @param last    Pointer past the last element
+ * @param threads Number of threads, including the calling one, zero for
+ *                the number of hardware threads
+ */
+template<typename T, typename Policy>
+inline void integral_sort(Integral<T, Policy>* first,
+                          Integral<T, Policy>* last, std::size_t threads) {
+    const std::size_t count = static_cast<std::size_t>(last - first);
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = std::min(threads, count / detail::parallelSortGrain);
+    if ((threads <= 1) || (sizeof(T) == 1)) {
+        integral_sort(first, last);
+        return;
+    }
+
+    using Key = detail::RadixKey<T>;
+    constexpr unsigned    bits    = 8;
+    constexpr std::size_t buckets = std::size_t{1} << bits;
+    const auto part = [&](const std::size_t index) {
+        return first + count * index / threads;
+    };
+
+    /* the least and greatest keys of every part, then of the range */
+    std::vector<typename Key::type> lows(threads), highs(threads);
+    detail::parallelFor(threads, [&](const std::size_t thread) {
+        lows[thread]  = Key::of(reduce_min(part(thread), part(thread + 1)));
+        highs[thread] = Key::of(reduce_max(part(thread), part(thread + 1)));
+    });
+    const typename Key::type least =
+        *std::min_element(lows.begin(), lows.end());
+    const unsigned shift = detail::radixSplitShift<T>(
+        static_cast<typename Key::type>(
+            *std::max_element(highs.begin(), highs.end()) - least),
+        bits);
+
+    /* offsets of thread t are offsets[t * buckets], buckets outermost */
+    std::vector<std::size_t> offsets(threads * buckets);
+    detail::parallelFor(threads, [&](const std::size_t thread) {
+        detail::radixSplitHistogram(part(thread), part(thread + 1), least,
+                                    shift, &offsets[thread * buckets]);
+    });
+
+    std::vector<std::size_t> starts(buckets + 1);
+    std::size_t total = 0;
+    for (std::size_t bucket = 0; bucket < buckets; ++bucket) {
+        starts[bucket] = total;
+        for (std::size_t thread = 0; thread < threads; ++thread) {
+            const std::size_t size = offsets[thread * buckets + bucket];
+            offsets[thread * buckets + bucket] = total;
+            total += size;
+        }
+    }
+    starts[buckets] = total;
+
+    auto buffer = detail::radixBuffer<T, Policy>(count);
+    detail::parallelFor(threads, [&](const std::size_t thread) {
+        detail::radixScatter(part(thread), part(thread + 1), buffer.get(),
+                             shift, bits, &offsets[thread * buckets], least);
+    });
+
+    std::vector<std::size_t> order(buckets);
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::stable_sort(order.begin(), order.end(),
+                     [&](const std::size_t lhs, const std::size_t rhs) {
+                         return (starts[lhs + 1] - starts[lhs]) >
+                                (starts[rhs + 1] - starts[rhs]);
+                     });
+
+    std::atomic<std::size_t> next{0};
+    detail::parallelFor(threads, [&](std::size_t) {
+        for (std::size_t index = next++; index < buckets; index = next++) {
+            const std::size_t start = starts[order[index]];
+            const std::size_t size  = starts[order[index] + 1] - start;
+            if (!detail::radixSort(buffer.get() + start, first + start, size)) {
+                std::copy(buffer.get() + start, buffer.get() + start + size,
+                          first + start);
+            }
+        }
+    });
+}
+
+} //< namespace compuSUAVE_Professional
+
+#endif //< INTEGRAL_SORT_CSP_H__
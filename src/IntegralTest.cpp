@@ -25,14 +25,56 @@
   */
 
 #include "Integral.hpp"
+#include "IntegralArray.hpp"
+#include "IntegralColumn.hpp"
+#include "IntegralReader.hpp"
+#include "IntegralReduce.hpp"
+#include "IntegralSort.hpp"
+#include "ModIntegral.hpp"
 
 #define CATCH_CONFIG_MAIN
 #include "catch.hpp"
 
+#include <random>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <cstdio>
 #include <cstring>
+#include <climits>
+#include <algorithm>
 
 namespace csp = compuSUAVE_Professional;
 
+// Checks one case of a sweep over many operands: only a failing case turns
+// into an assertion, reported along with the description of the case
+#define CHECK_CASE( condition, description ) \
+    do {                                       \
+        if (!(condition)) {                    \
+            INFO( description );               \
+            CHECK( (condition) );              \
+        }                                      \
+    } while (false)
+
+namespace {
+
+// Name of a type in failure reports, such as int8 or uint64
+template<typename T>
+std::string typeName()
+{
+    return (csp::detail::IntegralTraits<T>::is_signed ? "int" : "uint") + std::to_string(sizeof(T) * 8);
+}
+
+// Value in failure reports, character types print as numbers and 128-bit
+// types print at all
+template<typename T>
+csp::Integral<T> shown(const T value)
+{
+    return csp::Integral<T>{value};
+}
+
+} //< namespace
+
 TEST_CASE( "Default constructor must create an object with a value of zero", "[Integral<T>]" )
 {
     csp::Integral<int> value;
@@ -131,6 +173,314 @@ SCENARIO( "Given a C-String that can be parsed into an integral value" )
     }
 }
 
+SCENARIO( "Given a character range that is parsed with Integral<T>::parse" )
+{
+    WHEN( "Range represents a signed decimal value surrounded by whitespace" )
+    {
+        THEN( "Leading whitespace is skipped and parsing stops at the first non-digit" )
+        {
+            const char text[] = "  -137 ";
+            csp::Integral<int> object;
+
+            auto result = csp::Integral<int>::parse(text, text + 7, object);
+
+            REQUIRE( -137 == int(object) );
+            REQUIRE( (text + 6) == result.ptr );
+            REQUIRE( std::errc{} == result.ec );
+        }
+    }
+
+    WHEN( "Range uses upper case prefixes" )
+    {
+        THEN( "Binary and hexadecimal values are recognized" )
+        {
+            REQUIRE( 5 == int(csp::Integral<int>{"0B101"}) );
+            REQUIRE( 255 == int(csp::Integral<int>{"0XfF"}) );
+        }
+    }
+
+    WHEN( "Range holds a prefix without digits" )
+    {
+        THEN( "The leading zero is parsed as an octal value" )
+        {
+            const char text[] = "0x";
+            csp::Integral<int> object{7};
+
+            auto result = csp::Integral<int>::parse(text, text + 2, object);
+
+            REQUIRE( 0 == int(object) );
+            REQUIRE( (text + 1) == result.ptr );
+        }
+    }
+
+    WHEN( "Range holds no digits" )
+    {
+        THEN( "The object is left untouched and an error is reported" )
+        {
+            const char text[] = "-SEVEN";
+            csp::Integral<int> object{7};
+
+            auto result = csp::Integral<int>::parse(text, text + 6, object);
+
+            REQUIRE( 7 == int(object) );
+            REQUIRE( text == result.ptr );
+            REQUIRE( std::errc::invalid_argument == result.ec );
+        }
+    }
+
+    WHEN( "Range represents a value beyond the limits of the type" )
+    {
+        THEN( "The value is clamped and an error is reported" )
+        {
+            const char text[] = "-129";
+            csp::Integral<signed char> object;
+
+            auto result = csp::Integral<signed char>::parse(text, text + 4, object);
+
+            REQUIRE( -128 == int(object) );
+            REQUIRE( std::errc::result_out_of_range == result.ec );
+            REQUIRE( 255 == int(csp::Integral<unsigned char>{"0x100"}) );
+            REQUIRE( -128 == int(csp::Integral<signed char>{"-128"}) );
+        }
+    }
+
+    WHEN( "Range represents a value that fills a 64-bit type" )
+    {
+        THEN( "Every digit is accounted for" )
+        {
+            csp::Integral<unsigned long long> object{std::string{"18446744073709551615"}};
+
+            REQUIRE( 18446744073709551615ULL == (unsigned long long)(object) );
+        }
+    }
+
+    WHEN( "Range represents a value for a character type" )
+    {
+        THEN( "The digits are parsed as a number rather than as a character" )
+        {
+            csp::Integral<unsigned char> object{"65"};
+
+            REQUIRE( 65 == int(object) );
+        }
+    }
+}
+
+TEST_CASE( "Test decimal parsing kernels against the C library", "[Integral<T>]" )
+{
+    std::mt19937_64 engine{1337};
+
+    SECTION( "Test tokens of every length followed by junk" )
+    {
+        for (int i = 0; i < 4096; ++i) {
+            const std::string digits = std::to_string(engine() >> (engine() % 64));
+            const std::string text   = digits + ",1234567890123456789";
+            const char* first = text.data();
+            const char* last  = first + text.size();
+
+            csp::Integral<unsigned long long> wide;
+            auto result = csp::Integral<unsigned long long>::parse(first, last, wide);
+
+            REQUIRE( std::strtoull(first, nullptr, 10) == (unsigned long long)(wide) );
+            REQUIRE( (first + digits.size()) == result.ptr );
+
+            unsigned long long magnitude = 0;
+            bool overflow = false;
+
+            REQUIRE( (first + digits.size()) == csp::detail::accumulateDecimalSwar(first, last, magnitude, overflow) );
+            REQUIRE( (unsigned long long)(wide) == magnitude );
+
+#if defined(INTEGRAL_CSP_X86)
+            // The SSE4.1 kernel is only selected when compiling for a target
+            // that has it, so it is run directly whenever the processor can
+            if (csp::detail::cpuFeatures().sse41) {
+                magnitude = 0;
+
+                REQUIRE( (first + digits.size()) == csp::detail::accumulateDecimalSse41(first, last, magnitude, overflow) );
+                REQUIRE( (unsigned long long)(wide) == magnitude );
+            }
+#endif
+        }
+    }
+
+    SECTION( "Test overflow is detected for the target type" )
+    {
+        const std::string text = "18446744073709551616                ";
+        csp::Integral<unsigned long long> wide;
+        csp::Integral<unsigned> narrow;
+
+        auto result = csp::Integral<unsigned long long>::parse(text.data(), text.data() + text.size(), wide);
+
+        REQUIRE( std::errc::result_out_of_range == result.ec );
+        REQUIRE( csp::Integral<unsigned long long>::max() == (unsigned long long)(wide) );
+
+        result = csp::Integral<unsigned>::parse(text.data(), text.data() + 11, narrow);
+
+        REQUIRE( std::errc::result_out_of_range == result.ec );
+
+        result = csp::Integral<unsigned>::parse(text.data() + 11, text.data() + text.size(), narrow);
+
+        REQUIRE( std::errc{} == result.ec );
+        REQUIRE( 709551616u == unsigned(narrow) );
+    }
+
+    SECTION( "Test parsing remains a constant expression" )
+    {
+        constexpr csp::Integral<int> object{"-1234567890"};
+
+        static_assert(-1234567890 == int(object), "constexpr parse");
+    }
+}
+
+SCENARIO( "Given a delimited buffer that is parsed as a column" )
+{
+    WHEN( "Buffer spans several blocks and holds every representation" )
+    {
+        THEN( "Each token is parsed into its own row in order" )
+        {
+            std::string buffer;
+            std::vector<long long> expected;
+
+            for (long long i = 0; i < 100; ++i) {
+                buffer += std::to_string(i * 7919 - 300000) + "\r\n";
+                expected.push_back(i * 7919 - 300000);
+            }
+            buffer += "0x1F\n017\n0b101\n";
+            expected.insert(expected.end(), { 31, 15, 5 });
+
+            std::vector<csp::Integral<long long>> column(expected.size());
+            std::uint64_t errors[2];
+
+            auto result = csp::parse_column<long long>(buffer, '\n', column.data(), errors);
+
+            REQUIRE( expected.size() == result.rows );
+            REQUIRE( 0 == result.errors );
+            REQUIRE( 0 == errors[0] );
+            REQUIRE( 0 == errors[1] );
+
+            for (std::size_t row = 0; row < expected.size(); ++row) {
+                REQUIRE( expected[row] == (long long)(column[row]) );
+            }
+        }
+    }
+
+    WHEN( "Buffer holds malformed, empty and out of range tokens" )
+    {
+        THEN( "The rows in error are reported in the bitmap" )
+        {
+            const std::string buffer = "1,x,,300,4 ,5y,-1";
+            csp::Integral<unsigned char> column[7];
+            std::uint64_t errors[1];
+
+            auto result = csp::parse_column<unsigned char>(buffer, ',', column, errors);
+
+            REQUIRE( 7 == result.rows );
+            REQUIRE( 4 == result.errors );
+            REQUIRE( 0x2E == errors[0] );
+            REQUIRE( 0 == int(column[1]) );
+            REQUIRE( 255 == int(column[3]) );
+            REQUIRE( 4 == int(column[4]) );
+            REQUIRE( 255 == int(column[6]) );
+        }
+    }
+
+    WHEN( "Buffer holds a blank token followed by a valid one" )
+    {
+        THEN( "The blank token does not borrow the digits of the next row" )
+        {
+            const std::string buffer = "1\n \n2\n";
+            csp::Integral<int> column[3];
+
+            auto result = csp::parse_column<int>(buffer, '\n', column);
+
+            REQUIRE( 3 == result.rows );
+            REQUIRE( 1 == result.errors );
+            REQUIRE( 0 == int(column[1]) );
+            REQUIRE( 2 == int(column[2]) );
+        }
+    }
+
+    WHEN( "Delimiter search runs on every kernel the processor supports" )
+    {
+        THEN( "Each agrees with the portable search" )
+        {
+            std::mt19937_64 engine{64};
+            char block[64];
+
+            for (int i = 0; i < 1000; ++i) {
+                for (auto& c : block) {
+                    c = static_cast<char>('0' + (engine() % 12));
+                }
+                const std::uint64_t expected = csp::detail::delimiterMaskScalar(block, ';');
+                INFO( "block " << std::string(block, sizeof block) );
+
+                CHECK( expected == csp::detail::delimiterMaskKernel()(block, ';') );
+#if defined(INTEGRAL_CSP_X86)
+                CHECK( expected == csp::detail::delimiterMaskSse2(block, ';') );
+                if (csp::detail::cpuFeatures().avx2) {
+                    CHECK( expected == csp::detail::delimiterMaskAvx2(block, ';') );
+                }
+                if (csp::detail::cpuFeatures().avx512bw) {
+                    CHECK( expected == csp::detail::delimiterMaskAvx512(block, ';') );
+                }
+#endif
+            }
+        }
+    }
+}
+
+SCENARIO( "Given a text file of whitespace separated values" )
+{
+    char path[] = "/tmp/IntegralReaderXXXXXX";
+    const int descriptor = mkstemp(path);
+
+    REQUIRE( descriptor >= 0 );
+
+    const std::string content = "  17\n0x10 -3\r\nbad 0b11\n99999999999999999999\n42";
+    REQUIRE( content.size() == std::size_t(write(descriptor, content.data(), content.size())) );
+    close(descriptor);
+
+    WHEN( "Values are taken through the iterator interface" )
+    {
+        THEN( "Every token yields a value and malformed ones are counted" )
+        {
+            csp::IntegralReader<long long> reader{path};
+            std::vector<long long> values;
+
+            for (auto value : reader) {
+                values.push_back((long long)(value));
+            }
+
+            REQUIRE( (std::vector<long long>{ 17, 16, -3, 0, 3, 0, 42 }) == values );
+            REQUIRE( 2 == reader.errors() );
+        }
+    }
+
+    WHEN( "Values are taken in batches" )
+    {
+        THEN( "Each batch is filled until the end of the file" )
+        {
+            csp::IntegralReader<int> reader{std::string{path}};
+            csp::Integral<int> batch[4];
+
+            REQUIRE( 4 == reader.read(batch, 4) );
+            REQUIRE( -3 == int(batch[2]) );
+            REQUIRE( 3 == reader.read(batch, 4) );
+            REQUIRE( 42 == int(batch[2]) );
+            REQUIRE( 0 == reader.read(batch, 4) );
+        }
+    }
+
+    WHEN( "File does not exist" )
+    {
+        THEN( "An exception is thrown" )
+        {
+            REQUIRE_THROWS_AS( csp::IntegralReader<int>{"/nonexistent/IntegralReader"}, std::system_error );
+        }
+    }
+
+    std::remove(path);
+}
+
 TEST_CASE( "When one object is assigned to the other both should contain the same value", "[Integral<T>]" )
 {
     csp::Integral<int> value1{7};
@@ -350,13 +700,28 @@ TEST_CASE( "Test conversion operations", "[Integral<T>]" )
     {
         csp::Integral<int> value{7};
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
         const char* number = value;
+#pragma GCC diagnostic pop
 
         bool test = ( strcmp(number, "7") == 0 );
 
         REQUIRE( true == test );
     }
 
+    SECTION( "Test C-Strings of several values stay apart through dec()" )
+    {
+        csp::Integral<int> value1{7};
+        csp::Integral<int> value2{-12};
+
+        const auto text1 = value1.dec();
+        const auto text2 = value2.dec();
+
+        REQUIRE( 0 == strcmp(text1.c_str(), "7") );
+        REQUIRE( 0 == strcmp(text2.c_str(), "-12") );
+    }
+
     SECTION( "Test conversion to std::string object" )
     {
         csp::Integral<int> value{7};
@@ -443,81 +808,1672 @@ TEST_CASE( "Test base conversion operations", "[Integral<T>]" )
     }
 }
 
-TEST_CASE( "Test min and max functions to obtain larger or lesser object", "[Integral<T>]" )
+SCENARIO( "Given an object that is formatted into a caller supplied buffer" )
 {
-    csp::Integral<long long> value1{12LL};
-    csp::Integral<long long> value2{24LL};
+    WHEN( "Buffer is large enough to hold the representation" )
+    {
+        THEN( "The digits are written and the end of the representation is returned" )
+        {
+            csp::Integral<int> value{-255};
+            char buffer[16];
 
-    SECTION( "Test min function" )
+            auto result = value.to_chars(buffer, buffer + sizeof buffer, 16);
+
+            REQUIRE( std::errc{} == result.ec );
+            REQUIRE( std::string(buffer, result.ptr) == "-ff" );
+        }
+    }
+
+    WHEN( "Buffer is too small to hold the representation" )
     {
-        auto lesser = min(value1, value2);
+        THEN( "An error is reported and the end of the buffer is returned" )
+        {
+            csp::Integral<int> value{1000};
+            char buffer[3];
 
-        REQUIRE( 12 == long(lesser) );
+            auto result = value.to_chars(buffer, buffer + sizeof buffer);
+
+            REQUIRE( std::errc::value_too_large == result.ec );
+            REQUIRE( (buffer + sizeof buffer) == result.ptr );
+        }
     }
 
-    SECTION( "Test max function" )
+    WHEN( "Radix is outside of the supported range" )
     {
-        auto lesser = max(value1, value2);
+        THEN( "An error is reported" )
+        {
+            csp::Integral<int> value{7};
+            char buffer[8];
 
-        REQUIRE( 24 == long(lesser) );
+            REQUIRE( std::errc::invalid_argument == value.to_chars(buffer, buffer + 8, 37).ec );
+        }
+    }
+
+    WHEN( "Object holds the extreme values of its type" )
+    {
+        THEN( "Every digit and the sign are written" )
+        {
+            char buffer[80];
+
+            auto minimum = csp::Integral<long long>{csp::Integral<long long>::min()};
+            auto written = minimum.to_chars(buffer, buffer + sizeof buffer, 2);
+
+            REQUIRE( 65 == (written.ptr - buffer) );
+
+            auto maximum = csp::Integral<unsigned long long>{csp::Integral<unsigned long long>::max()};
+            written = maximum.to_chars(buffer, buffer + sizeof buffer, 36);
+
+            REQUIRE( std::string(buffer, written.ptr) == "3w5e11264sgsf" );
+        }
     }
 }
 
-TEST_CASE( "Test numerical property methods", "[Integral<T>]")
+TEST_CASE( "Test decimal formatting at every digit count boundary", "[Integral<T>]" )
 {
-    csp::Integral<long long> value{12LL};
+    SECTION( "Test 8-bit and 16-bit widths against every value" )
+    {
+        for (int i = -128; i < 128; ++i) {
+            REQUIRE( std::to_string(i) == std::string(csp::Integral<signed char>{i}.dec()) );
+        }
+        for (unsigned i = 0; i < 65536; ++i) {
+            REQUIRE( std::to_string(i) == std::string(csp::Integral<unsigned short>{i}.dec()) );
+        }
+    }
 
-    SECTION( "Test odd method" )
+    SECTION( "Test 32-bit and 64-bit widths around powers of ten" )
     {
-        bool test = value.odd();
+        unsigned long long power = 1;
 
-        REQUIRE( false == test );
+        for (int digits = 1; digits < 20; ++digits, power *= 10) {
+            for (auto value : { power - 1, power, power + 1 }) {
+                REQUIRE( std::to_string(value) == std::string(csp::Integral<unsigned long long>{value}.dec()) );
+                REQUIRE( std::to_string(unsigned(value)) == std::string(csp::Integral<unsigned>{value}.dec()) );
+            }
+        }
+
+        const auto maximum = csp::Integral<unsigned long long>::max();
+
+        REQUIRE( std::to_string(maximum) == std::string(csp::Integral<unsigned long long>{maximum}.dec()) );
     }
+}
 
-    SECTION( "Test even method" )
+TEST_CASE( "Test hexadecimal and binary kernels against the generic radix loop", "[Integral<T>]" )
+{
+    std::mt19937_64 engine{2015};
+
+    SECTION( "Test every selectable kernel produces the same digits" )
     {
-        bool test = value.even();
+        for (int i = 0; i < 4096; ++i) {
+            const unsigned long long value = engine() >> (i % 64);
+            char expected[64];
+            char actual[64];
 
-        REQUIRE( true == test );
+            auto generic = csp::detail::formatUnsigned(expected, expected + 64, value, 16);
+            csp::detail::hexDigitsSwar(actual, value);
+
+            REQUIRE( std::string(expected, generic.ptr) == std::string(actual + 16 - (generic.ptr - expected), actual + 16) );
+
+            generic = csp::detail::formatUnsigned(expected, expected + 64, value, 2);
+            auto kernel = csp::Integral<unsigned long long>{value}.to_chars(actual, actual + 64, 2);
+
+            REQUIRE( std::string(expected, generic.ptr) == std::string(actual, kernel.ptr) );
+        }
+
+        for (unsigned byte = 0; byte < 256; ++byte) {
+            const auto chars = csp::detail::expandBitsMultiply(byte);
+            char expected[9];
+
+            csp::detail::formatUnsigned(expected, expected + 9, byte | 0x100u, 2);
+
+            REQUIRE( 0 == std::memcmp(&chars, expected + 1, 8) );
+        }
+    }
+
+    SECTION( "Test narrow types keep only their significant digits" )
+    {
+        REQUIRE( 0 == strcmp(csp::Integral<unsigned char>{0xA5}.hex(), "a5") );
+        REQUIRE( 0 == strcmp(csp::Integral<unsigned char>{0x05}.bin(), "101") );
+        REQUIRE( 0 == strcmp(csp::Integral<short>{-2}.bin(), "1111111111111110") );
     }
 }
 
-TEST_CASE( "Test user defined literals", "[Integral<T>]" )
+TEST_CASE( "Test legacy conversions of negative and zero values", "[Integral<T>]" )
 {
-    using namespace compuSUAVE_Professional;
+    SECTION( "Test decimal conversion keeps the sign" )
+    {
+        csp::Integral<short> value{-7};
 
-    SECTION( "Test unsigned char type" )
+        REQUIRE( 0 == strcmp(value.dec(), "-7") );
+    }
+
+    SECTION( "Test other radixes represent the bit pattern" )
     {
-        auto object = 65_cspiuc;
+        csp::Integral<int> value{-1};
 
-        REQUIRE( 'A' == char(object) );
+        REQUIRE( 0 == strcmp(value.hex(), "ffffffff") );
+        REQUIRE( 0 == strcmp(value.oct(), "37777777777") );
     }
 
-    SECTION( "Test unsigned short type" )
+    SECTION( "Test zero is represented by a single digit" )
     {
-        auto object = 97_cspius;
+        csp::Integral<int> value;
 
-        REQUIRE( 'a' == short(object) );
+        REQUIRE( 0 == strcmp(value.bin(), "0") );
+        REQUIRE( 0 == strcmp(value.toRadix(0), "0") );
     }
+}
 
-    SECTION( "Test unsigned int type" )
+namespace {
+
+// Table of two digit hexadecimal names generated at compile time
+struct HexTable {
+    csp::FixedString<2> names[256];
+};
+
+constexpr HexTable makeHexTable() noexcept
+{
+    HexTable table{};
+    for (unsigned i = 0; i < 256; ++i) {
+        table.names[i] = csp::Integral<unsigned char>{i}.toRadix<16>();
+    }
+    return table;
+}
+
+constexpr HexTable hex_table = makeHexTable();
+
+} //< namespace
+
+TEST_CASE( "Test radix conversions in constant expressions", "[Integral<T>]" )
+{
+    SECTION( "Test every radix is evaluated at compile time" )
     {
-        auto object = 0_cspiui;
+        static_assert( csp::Integral<short>{-1234}.dec() == "-1234", "dec" );
+        static_assert( csp::Integral<int>{-1}.hex() == "ffffffff", "hex" );
+        static_assert( csp::Integral<unsigned char>{5}.bin() == "101", "bin" );
+        static_assert( csp::Integral<unsigned>{8}.oct() == "10", "oct" );
+        static_assert( csp::Integral<int>{35}.toRadix<36>() == "z", "base 36" );
+        static_assert( csp::Integral<long long>{std::numeric_limits<long long>::min()}.toRadix<10>()
+                       == "-9223372036854775808", "minimum" );
+        static_assert( "0" == csp::Integral<unsigned long long>{}.toRadix<2>(), "zero" );
+        static_assert( csp::Integral<int>{7}.dec() != "70", "prefix" );
+    }
 
-        REQUIRE( '\0' == unsigned(object) );
+    SECTION( "Test capacity is sized for the radix" )
+    {
+        using byte = csp::Integral<unsigned char>;
+        using word = csp::Integral<int>;
+
+        static_assert( 2 == decltype(byte{}.toRadix<16>())::capacity(), "hex" );
+        static_assert( 8 == decltype(byte{}.toRadix<2>())::capacity(), "bin" );
+        static_assert( 3 == decltype(byte{}.toRadix<10>())::capacity(), "dec" );
+        static_assert( 11 == decltype(word{}.toRadix<10>())::capacity(), "sign" );
+        static_assert( 11 == decltype(word{}.toRadix<8>())::capacity(), "oct" );
     }
 
-    SECTION( "Test unsigned long type" )
+    SECTION( "Test tables generated at compile time match the runtime kernels" )
     {
-        auto object = 100_cspiul;
+        for (unsigned i = 0; i < 256; ++i) {
+            REQUIRE( hex_table.names[i] == csp::Integral<unsigned char>{i}.hex() );
+        }
+        REQUIRE( "ff" == hex_table.names[255].view() );
+    }
+}
 
-        REQUIRE( 100 == long(object) );
+TEST_CASE( "Test overflow policies", "[Integral<T>]" )
+{
+    using namespace csp::overflow;
+
+    SECTION( "Test wrapping arithmetic is the default and defined for signed types" )
+    {
+        using wrapping = csp::Integral<int>;
+
+        static_assert( std::is_same<wrapping::policy_type, Wrapping>::value, "default policy" );
+        static_assert( INT_MIN == int(wrapping{INT_MAX} + wrapping{1}), "add" );
+        static_assert( INT_MAX == int(wrapping{INT_MIN} - wrapping{1}), "sub" );
+        static_assert( INT_MIN == int(wrapping{INT_MIN} / wrapping{-1}), "div" );
+        static_assert( 0 == int(wrapping{INT_MIN} % wrapping{-1}), "mod" );
+        static_assert( !Wrapping::checks_divisor, "zero divisor is a precondition" );
+        static_assert( INT_MIN == int(-wrapping{INT_MIN}), "negate" );
+
+        csp::Integral<unsigned char> value{255};
+
+        REQUIRE( 0 == int(++value) );
+        REQUIRE( 255 == int(--value) );
     }
 
-    SECTION( "Test unsigned long long type" )
+    SECTION( "Test saturating arithmetic clamps to the nearest bound" )
     {
-        auto object = 12345_cspiull;
+        using saturating = csp::Integral<int, Saturating>;
+        using counter    = csp::Integral<unsigned short, Saturating>;
+
+        static_assert( INT_MAX == int(saturating{INT_MAX} + saturating{1}), "add" );
+        static_assert( INT_MIN == int(saturating{INT_MIN} + saturating{-1}), "add" );
+        static_assert( INT_MIN == int(saturating{INT_MIN} - saturating{1}), "sub" );
+        static_assert( INT_MAX == int(saturating{0} - saturating{INT_MIN}), "sub" );
+        static_assert( INT_MIN == int(saturating{INT_MAX} * saturating{-2}), "mul" );
+        static_assert( INT_MAX == int(saturating{INT_MIN} * saturating{-2}), "mul" );
+        static_assert( INT_MAX == int(saturating{INT_MIN} / saturating{-1}), "div" );
+        static_assert( INT_MAX == int(saturating{5} / saturating{0}), "division by zero" );
+        static_assert( INT_MIN == int(saturating{-5} / saturating{0}), "division by zero" );
+        static_assert( 0 == int(saturating{5} % saturating{0}), "modulo by zero" );
+        static_assert( INT_MAX == int(-saturating{INT_MIN}), "negate" );
+        static_assert( 0 == unsigned(counter{3} - counter{5}), "unsigned sub" );
+
+        counter meter{65534};
+
+        REQUIRE( 65535 == int(++meter) );
+        REQUIRE( 65535 == int(meter++) );
+        REQUIRE( 65535 == int(meter) );
+
+        counter empty{0};
+
+        REQUIRE( 0 == int(--empty) );
+    }
 
-        REQUIRE( 12345 == long(object) );
+    SECTION( "Test checked arithmetic reports overflow alongside the wrapped result" )
+    {
+        using checked = csp::Integral<long long, Checked>;
+
+        constexpr auto fits = checked{40} + checked{2};
+        constexpr auto wraps = checked{LLONG_MAX} * checked{2};
+
+        static_assert( fits.has_value() && (42 == (long long)(fits.value())), "fits" );
+        static_assert( wraps.overflow() && !wraps, "overflow" );
+        static_assert( -2 == (long long)(wraps.wrapped()), "wrapped" );
+        static_assert( 7 == (long long)(wraps.value_or(checked{7})), "fallback" );
+        static_assert( !(checked{1} / checked{0}).has_value(), "division by zero" );
+        static_assert( !(checked{1} % checked{0}).has_value(), "modulo by zero" );
+        static_assert( (checked{LLONG_MIN} % checked{-1}).has_value(), "exact remainder" );
+        static_assert( !(-checked{LLONG_MIN}).has_value(), "negate" );
+
+        REQUIRE_THROWS_AS( wraps.value(), std::overflow_error );
+    }
+
+    SECTION( "Test trapping arithmetic behaves as wrapping arithmetic while results fit" )
+    {
+        using trapping = csp::Integral<short, Trapping>;
+
+        static_assert( -32768 == int(trapping{-32767} - trapping{1}), "sub" );
+        static_assert( 32767 == int(trapping{-32767} * trapping{-1}), "mul" );
+
+        trapping value{32766};
+
+        REQUIRE( 32767 == int(++value) );
+    }
+
+    SECTION( "Test objects of other policies are read by the column parser and the stream operators" )
+    {
+        csp::Integral<unsigned char, Saturating> column[2];
+        std::istringstream input{"200"};
+
+        REQUIRE( 1 == csp::parse_column("250,300", ',', column).errors );
+        REQUIRE( 255 == int(column[0] + column[1]) );
+        REQUIRE( input >> column[0] );
+        REQUIRE( 255 == int(column[0] + column[0]) );
+    }
+}
+
+namespace {
+
+// Checks the quotients and remainders of the dividers against the plain
+// operators
+template<typename T>
+void checkDividers(const T divisor, const std::vector<T>& numerators)
+{
+    using integral = csp::Integral<T>;
+
+    const typename integral::divider            divider{integral{divisor}};
+    const typename integral::branchfree_divider branchfree{integral{divisor}};
+
+    for (const T numerator : numerators) {
+        const integral value{numerator};
+        const T quotient  = T(value / integral{divisor});
+        const T remainder = T(value % integral{divisor});
+
+        CHECK_CASE( quotient == T(value / divider), typeName<T>() << ": " << shown(numerator) << " / " << shown(divisor) );
+        CHECK_CASE( remainder == T(value % divider), typeName<T>() << ": " << shown(numerator) << " % " << shown(divisor) );
+        CHECK_CASE( quotient == T(value / branchfree), typeName<T>() << ": " << shown(numerator) << " / branchfree " << shown(divisor) );
+        CHECK_CASE( remainder == T(value % branchfree), typeName<T>() << ": " << shown(numerator) << " % branchfree " << shown(divisor) );
+    }
+}
+
+// Every value of an 8-bit type or the edges and a random sample of a wider one
+template<typename T>
+std::vector<T> dividerOperands(std::mt19937_64& engine, const int samples = 512)
+{
+    std::vector<T> values;
+    if (sizeof(T) == 1) {
+        for (int value = int(std::numeric_limits<T>::min()); value <= int(std::numeric_limits<T>::max()); ++value) {
+            values.push_back(T(value));
+        }
+        return values;
+    }
+
+    for (T edge : { std::numeric_limits<T>::min(), T(std::numeric_limits<T>::min() + 1),
+                    T(-1), T(0), T(1), T(2), T(3), T(7), T(10),
+                    T(std::numeric_limits<T>::max() - 1), std::numeric_limits<T>::max() }) {
+        values.push_back(edge);
+    }
+    for (unsigned shift = 0; shift < std::numeric_limits<T>::digits; ++shift) {
+        values.push_back(T(T(1) << shift));
+        values.push_back(T(T(T(1) << shift) + 1));
+    }
+    for (int i = 0; i < samples; ++i) {
+        values.push_back(T(engine() >> (engine() % 64)));
+    }
+    return values;
+}
+
+template<typename T>
+void checkDividers(std::mt19937_64& engine)
+{
+    const std::vector<T> numerators = dividerOperands<T>(engine);
+
+    for (const T divisor : dividerOperands<T>(engine)) {
+        if (divisor != T(0)) {
+            checkDividers(divisor, numerators);
+        }
+    }
+}
+
+} //< namespace
+
+TEST_CASE( "Test division by invariant divisors", "[Integral<T>]" )
+{
+    std::mt19937_64 engine{42};
+
+    SECTION( "Test dividers agree with the plain operators for every width" )
+    {
+        checkDividers<signed char>(engine);
+        checkDividers<unsigned char>(engine);
+        checkDividers<short>(engine);
+        checkDividers<unsigned short>(engine);
+        checkDividers<int>(engine);
+        checkDividers<unsigned>(engine);
+        checkDividers<long>(engine);
+        checkDividers<unsigned long long>(engine);
+    }
+
+    SECTION( "Test every 16-bit divisor" )
+    {
+        std::vector<unsigned short> numerators = dividerOperands<unsigned short>(engine, 16);
+        std::vector<short> signed_numerators = dividerOperands<short>(engine, 16);
+
+        for (unsigned divisor = 1; divisor <= 0xFFFF; ++divisor) {
+            checkDividers((unsigned short)divisor, numerators);
+            if (short(divisor) != 0) {
+                checkDividers(short(divisor), signed_numerators);
+            }
+        }
+    }
+
+    SECTION( "Test policies, batches and precomputation at compile time" )
+    {
+        using checked = csp::Integral<int, csp::overflow::Checked>;
+        using divider = csp::Integral<unsigned>::branchfree_divider;
+
+        constexpr checked::divider minus_one{checked{-1}};
+
+        static_assert( !(checked{INT_MIN} / minus_one).has_value(), "overflow" );
+        static_assert( 0 == int((checked{INT_MIN} % minus_one).value()), "remainder" );
+        static_assert( 14 == unsigned(csp::Integral<unsigned>{100} / divider{7u}), "quotient" );
+
+        csp::Integral<unsigned> values[] = { 0u, 6u, 7u, 100u, 0xFFFFFFFFu };
+        divider{7u}.divide(values, 5, values);
+
+        REQUIRE( 0 == unsigned(values[0]) );
+        REQUIRE( 0 == unsigned(values[1]) );
+        REQUIRE( 1 == unsigned(values[2]) );
+        REQUIRE( 14 == unsigned(values[3]) );
+        REQUIRE( 613566756u == unsigned(values[4]) );
+        REQUIRE( 7 == unsigned(divider{7u}.divisor()) );
+        REQUIRE_THROWS_AS( divider{0u}, std::invalid_argument );
+    }
+}
+
+namespace {
+
+// Checks the sums, differences, products and powers of a reduction against
+// the naive computation on 128-bit integers
+template<typename Modulus>
+void checkModular(const char* name, const typename Modulus::value_type modulus,
+                  std::mt19937_64& engine)
+{
+    using T       = typename Modulus::value_type;
+    using residue = csp::ModIntegral<T, Modulus>;
+    using wide    = unsigned __int128;
+
+    const Modulus reduction{csp::Integral<T>{modulus}};
+
+    for (int i = 0; i < 2000; ++i) {
+        const T a = T(engine());
+        const T b = (i % 3) ? T(engine()) : T(modulus - 1 - (i % 2));
+        const unsigned exponent = unsigned(engine() % 70);
+
+        const residue x{reduction, a};
+        const residue y{reduction, b};
+
+        wide power = 1 % modulus;
+        for (unsigned e = 0; e < exponent; ++e) {
+            power = (power * (a % modulus)) % modulus;
+        }
+
+        const auto operands = [&] {
+            std::ostringstream out;
+            out << name << " " << typeName<T>() << " modulo " << shown(modulus)
+                << ": a = " << shown(a) << ", b = " << shown(b) << ", ";
+            return out.str();
+        };
+
+        CHECK_CASE( T((x + y).value()) == T((wide(a) % modulus + b % modulus) % modulus), operands() << "a + b" );
+        CHECK_CASE( T((x - y).value()) == T((wide(a) % modulus + modulus - b % modulus) % modulus), operands() << "a - b" );
+        CHECK_CASE( T((x * y).value()) == T((wide(a) * b) % modulus), operands() << "a * b" );
+        CHECK_CASE( T(x.pow(exponent).value()) == T(power), operands() << "a ^ " << exponent );
+        CHECK_CASE( (-x + x) == residue{reduction}, operands() << "-a + a" );
+    }
+}
+
+} //< namespace
+
+TEST_CASE( "Test modular arithmetic", "[ModIntegral<T>]" )
+{
+    std::mt19937_64 engine{42};
+
+    SECTION( "Test Montgomery and Barrett reductions against 128-bit arithmetic" )
+    {
+        using u32 = std::uint32_t;
+        using u64 = std::uint64_t;
+        using montgomery32 = csp::MontgomeryModulus<u32>;
+        using montgomery64 = csp::MontgomeryModulus<u64>;
+        using barrett32    = csp::BarrettModulus<u32>;
+        using barrett64    = csp::BarrettModulus<u64>;
+
+        for (u64 modulus : { 1ull, 3ull, 1000000007ull, 0xFFFFFFFBull,
+                             0xFFFFFFFFFFFFFFC5ull, 0xFFFFFFFFFFFFFFFFull,
+                             (1ull << 61) - 1, 0x8000000000000001ull }) {
+            checkModular<montgomery64>("Montgomery", modulus, engine);
+            checkModular<barrett64>("Barrett", modulus, engine);
+        }
+
+        for (u64 modulus : { 2ull, 1ull << 32, 1ull << 63, 998244352ull,
+                             0xFFFFFFFFFFFFFFFEull }) {
+            checkModular<barrett64>("Barrett", modulus, engine);
+        }
+
+        for (u32 modulus : { 1u, 7u, 65521u, 0xFFFFFFFBu, 0xFFFFFFFFu }) {
+            checkModular<montgomery32>("Montgomery", modulus, engine);
+            checkModular<barrett32>("Barrett", modulus, engine);
+        }
+
+        for (int i = 0; i < 64; ++i) {
+            const u64 modulus = (engine() >> (engine() % 63)) | 1u;
+
+            checkModular<montgomery64>("Montgomery", modulus, engine);
+            checkModular<barrett64>("Barrett", modulus - (i % 2), engine);
+        }
+    }
+
+    SECTION( "Test conversions and narrow types" )
+    {
+        const csp::MontgomeryModulus<unsigned char> modulus{csp::Integral<unsigned char>{251}};
+        const csp::MontgomeryIntegral<unsigned char> value{modulus, 250};
+
+        REQUIRE( 250 == int(value.value()) );
+        REQUIRE( 250 == int((value * value * value).value()) );
+        REQUIRE( 1 == int(value.pow(250).value()) );
+        REQUIRE( 251 == int(value.modulus().modulus()) );
+    }
+
+    SECTION( "Test moduli a reduction cannot work with are rejected" )
+    {
+        using u64 = std::uint64_t;
+
+        REQUIRE_THROWS_AS( csp::MontgomeryModulus<u64>{csp::Integral<u64>{10}}, std::invalid_argument );
+        REQUIRE_THROWS_AS( csp::BarrettModulus<u64>{csp::Integral<u64>{0}}, std::invalid_argument );
+    }
+}
+
+TEST_CASE( "Test 128-bit integrals and widening multiplication", "[Integral<T>]" )
+{
+    using i128 = csp::Integral<__int128>;
+    using u128 = csp::Integral<unsigned __int128>;
+
+    const unsigned __int128 all_ones = ~(unsigned __int128)0;
+    const __int128 lowest = -(__int128)(all_ones >> 1) - 1;
+
+    SECTION( "Test limits, formatting and parsing of the extremes" )
+    {
+        REQUIRE( u128{all_ones} == u128{u128::max()} );
+        REQUIRE( i128{lowest} == i128{i128::min()} );
+        REQUIRE( "340282366920938463463374607431768211455" == u128{all_ones}.dec() );
+        REQUIRE( "-170141183460469231731687303715884105728" == i128{lowest}.dec() );
+        REQUIRE( "ffffffffffffffffffffffffffffffff" == u128{all_ones}.hex() );
+        REQUIRE( "10000000000000000000000000000000000000000" == u128{(unsigned __int128)1 << 40 << 40 << 40}.oct() );
+        REQUIRE( "1" + std::string(64, '0') + "1" == u128{((unsigned __int128)1 << 65) + 1}.bin().c_str() );
+        REQUIRE( "100000000000000000000000000000000000000" == u128{"0x4B3B4CA85A86C47A098A224000000000"}.dec() );
+
+        REQUIRE( u128{all_ones} == u128{"340282366920938463463374607431768211455"} );
+        REQUIRE( i128{lowest} == i128{"-170141183460469231731687303715884105728"} );
+
+        const std::string overflow = "340282366920938463463374607431768211456";
+        u128 clamped;
+        REQUIRE( std::errc::result_out_of_range == u128::parse(overflow.data(), overflow.data() + overflow.size(), clamped).ec );
+        REQUIRE( u128{all_ones} == clamped );
+
+        std::ostringstream output;
+        output << i128{lowest} << ' ' << std::hex << std::showbase << u128{all_ones};
+        REQUIRE( "-170141183460469231731687303715884105728 0xffffffffffffffffffffffffffffffff" == output.str() );
+
+        std::istringstream input{output.str()};
+        i128 a;
+        u128 b;
+        input >> a >> b;
+        REQUIRE( i128{lowest} == a );
+        REQUIRE( u128{all_ones} == b );
+    }
+
+    SECTION( "Test literals and conversions at compile time" )
+    {
+        using namespace compuSUAVE_Professional;
+
+        constexpr u128 top = 0xFFFF'FFFF'FFFF'FFFF'FFFF'FFFF'FFFF'FFFF_cspiu128;
+        constexpr i128 big = 170141183460469231731687303715884105727_cspi128;
+
+        static_assert( u128::max() == (unsigned __int128)(top), "unsigned literal" );
+        static_assert( i128::max() == (__int128)(big), "signed literal" );
+        static_assert( top.toRadix<10>() == "340282366920938463463374607431768211455", "decimal" );
+        static_assert( 39 == decltype(top.toRadix<10>())::capacity(), "capacity" );
+    }
+
+    SECTION( "Test widening products against 128-bit arithmetic" )
+    {
+        std::mt19937_64 engine{42};
+
+        for (int i = 0; i < 10000; ++i) {
+            const std::uint64_t x = engine() >> (i % 64);
+            const std::uint64_t y = engine();
+            const unsigned __int128 product = (unsigned __int128)x * y;
+            const __int128 signed_product = (__int128)(std::int64_t)x * (std::int64_t)y;
+
+            const csp::Integral<std::uint64_t> ux{x}, uy{y};
+            const csp::Integral<std::int64_t> sx{std::int64_t(x)}, sy{std::int64_t(y)};
+            const csp::Integral<std::uint32_t> nx{std::uint32_t(x)}, ny{std::uint32_t(y)};
+            const csp::Integral<std::int32_t> mx{std::int32_t(x)}, my{std::int32_t(y)};
+
+            CHECK_CASE( product == (unsigned __int128)(mul_wide(ux, uy)), "uint64 mul_wide " << ux << " * " << uy );
+            CHECK_CASE( std::uint64_t(product >> 64) == std::uint64_t(mulhi(ux, uy)), "uint64 mulhi " << ux << " * " << uy );
+            CHECK_CASE( signed_product == (__int128)(mul_wide(sx, sy)), "int64 mul_wide " << sx << " * " << sy );
+            CHECK_CASE( std::int64_t(signed_product >> 64) == std::int64_t(mulhi(sx, sy)), "int64 mulhi " << sx << " * " << sy );
+            CHECK_CASE( std::uint64_t(std::uint32_t(x)) * std::uint32_t(y) == std::uint64_t(mul_wide(nx, ny)), "uint32 mul_wide " << nx << " * " << ny );
+            CHECK_CASE( std::int64_t(std::int32_t(x)) * std::int32_t(y) == std::int64_t(mul_wide(mx, my)), "int32 mul_wide " << mx << " * " << my );
+            CHECK_CASE( std::int32_t((std::int64_t(std::int32_t(x)) * std::int32_t(y)) >> 32) == std::int32_t(mulhi(mx, my)), "int32 mulhi " << mx << " * " << my );
+        }
+
+        static_assert( std::is_same<decltype(mul_wide(csp::Integral<short>{}, csp::Integral<short>{})),
+                                    csp::Integral<std::int32_t>>::value, "widened type" );
+        static_assert( -1 == (signed char)(mulhi(csp::Integral<signed char>{-1}, csp::Integral<signed char>{1})), "high half" );
+    }
+}
+
+SCENARIO( "Given a stream of textual values" )
+{
+    WHEN( "Values are extracted into objects" )
+    {
+        THEN( "Each representation is recognized and extraction stops on the first non-numerical character" )
+        {
+            std::istringstream input{"  42 0x1F\t-7 0b101 017,9"};
+            csp::Integral<int> a, b, c, d, e, f;
+
+            input >> a >> b >> c >> d >> e;
+
+            REQUIRE( 42 == int(a) );
+            REQUIRE( 31 == int(b) );
+            REQUIRE( -7 == int(c) );
+            REQUIRE( 5 == int(d) );
+            REQUIRE( 15 == int(e) );
+            REQUIRE( ',' == input.peek() );
+
+            input.ignore();
+            input >> f;
+
+            REQUIRE( 9 == int(f) );
+            REQUIRE( input.eof() );
+            REQUIRE( !input.fail() );
+        }
+    }
+
+    WHEN( "Stream holds no digits or too large a value" )
+    {
+        THEN( "Extraction fails" )
+        {
+            std::istringstream junk{"junk"};
+            csp::Integral<int> value{7};
+
+            REQUIRE( !(junk >> value) );
+            REQUIRE( 0 == int(value) );
+
+            std::istringstream large{"300 -000000000000000000000000000000000000000000000000000000000001"};
+            csp::Integral<signed char> narrow;
+
+            REQUIRE( !(large >> narrow) );
+            REQUIRE( 127 == int(narrow) );
+
+            large.clear();
+
+            REQUIRE( (large >> narrow) );
+            REQUIRE( -1 == int(narrow) );
+        }
+    }
+
+    WHEN( "Stream holds a radix prefix without digits" )
+    {
+        THEN( "The leading zero is extracted and the marker is left in the stream" )
+        {
+            std::istringstream input{"0x -0bz 0X"};
+            csp::Integral<int> value{7};
+
+            REQUIRE( (input >> value) );
+            REQUIRE( 0 == int(value) );
+            REQUIRE( 'x' == input.get() );
+
+            value = 7;
+
+            REQUIRE( (input >> value) );
+            REQUIRE( 0 == int(value) );
+            REQUIRE( 'b' == input.get() );
+            REQUIRE( 'z' == input.get() );
+
+            REQUIRE( (input >> value) );
+            REQUIRE( 'X' == input.peek() );
+        }
+    }
+}
+
+TEST_CASE( "Test stream insertion honors the formatting state of the stream", "[Integral<T>]" )
+{
+    const std::ios_base::fmtflags bases[]   = { std::ios_base::dec, std::ios_base::hex, std::ios_base::oct };
+    const std::ios_base::fmtflags adjusts[] = { std::ios_base::right, std::ios_base::left, std::ios_base::internal };
+
+    for (long long value : { 0LL, 7LL, -7LL, 255LL, -9223372036854775807LL - 1 }) {
+        for (auto base : bases) {
+            for (auto adjust : adjusts) {
+                for (int extra = 0; extra < 8; ++extra) {
+                    std::ostringstream expected;
+                    std::ostringstream actual;
+
+                    for (std::ostream* os : { (std::ostream*)&expected, (std::ostream*)&actual }) {
+                        os->setf(base, std::ios_base::basefield);
+                        os->setf(adjust, std::ios_base::adjustfield);
+                        if (extra & 1) os->setf(std::ios_base::showbase);
+                        if (extra & 2) os->setf(std::ios_base::showpos);
+                        if (extra & 4) os->setf(std::ios_base::uppercase);
+                        os->fill('*');
+                    }
+
+                    expected << std::setw(24) << value << '|' << short(value);
+                    actual << std::setw(24) << csp::Integral<long long>{value} << '|' << csp::Integral<short>{value};
+
+                    REQUIRE( expected.str() == actual.str() );
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE( "Test min and max functions to obtain larger or lesser object", "[Integral<T>]" )
+{
+    csp::Integral<long long> value1{12LL};
+    csp::Integral<long long> value2{24LL};
+
+    SECTION( "Test min function" )
+    {
+        auto lesser = min(value1, value2);
+
+        REQUIRE( 12 == long(lesser) );
+    }
+
+    SECTION( "Test max function" )
+    {
+        auto lesser = max(value1, value2);
+
+        REQUIRE( 24 == long(lesser) );
+    }
+
+    SECTION( "Test equal objects and evaluation at compile time" )
+    {
+        using value = csp::Integral<int>;
+
+        static_assert( 7 == int(max(value{7}, value{7})), "max of equal objects" );
+        static_assert( -3 == int(min(value{-3}, value{5})), "min" );
+        static_assert( 5 == int(max(value{-3}, value{5})), "max" );
+
+        REQUIRE( 12 == long(max(value1, value1)) );
+    }
+}
+
+TEST_CASE( "Test three-way comparison and relational operators", "[Integral<T>]" )
+{
+    using value = csp::Integral<int>;
+    const int samples[] = { INT_MIN, -7, -1, 0, 1, 7, INT_MAX };
+
+    SECTION( "Test every operator agrees with the raw type, equal operands included" )
+    {
+        for (int a : samples) {
+            for (int b : samples) {
+                const value x{a}, y{b};
+
+                CHECK_CASE( (a < b) == (x < y), a << " < " << b );
+                CHECK_CASE( (a > b) == (x > y), a << " > " << b );
+                CHECK_CASE( (a <= b) == (x <= y), a << " <= " << b );
+                CHECK_CASE( (a >= b) == (x >= y), a << " >= " << b );
+                CHECK_CASE( (a == b) == (x == y), a << " == " << b );
+                CHECK_CASE( (a != b) == (x != y), a << " != " << b );
+                CHECK_CASE( ((a > b) - (a < b)) == compare(x, y).value(), "compare(" << a << ", " << b << ")" );
+                CHECK_CASE( (a < b) == (compare(x, y) < 0), "compare(" << a << ", " << b << ") < 0" );
+                CHECK_CASE( (a == b) == (compare(x, y) == 0), "compare(" << a << ", " << b << ") == 0" );
+                CHECK_CASE( std::min(a, b) == int(min(x, y)), "min(" << a << ", " << b << ")" );
+                CHECK_CASE( std::max(a, b) == int(max(x, y)), "max(" << a << ", " << b << ")" );
+            }
+        }
+    }
+
+    SECTION( "Test unsigned operands and evaluation at compile time" )
+    {
+        using unsigned_value = csp::Integral<unsigned>;
+
+        static_assert( compare(unsigned_value{0xFFFFFFFFu}, unsigned_value{1u}) > 0, "unsigned" );
+        static_assert( value{2} >= value{2} && !(value{2} > value{2}), "equal operands" );
+        static_assert( -1 == compare(value{-2}, value{2}).value(), "sign" );
+    }
+}
+
+TEST_CASE( "Test copying objects as raw memory", "[Integral<T>]" )
+{
+    using value = csp::Integral<long long, csp::overflow::Saturating>;
+
+    SECTION( "Test the layout matches the wrapped type" )
+    {
+        static_assert( std::is_trivially_copyable<value>::value, "trivially copyable" );
+        static_assert( std::is_standard_layout<value>::value, "standard layout" );
+        static_assert( sizeof(value) == sizeof(long long), "size" );
+        static_assert( alignof(value) == alignof(long long), "alignment" );
+        static_assert( std::is_trivially_copyable<csp::Integral<unsigned char>>::value, "narrow" );
+    }
+
+    SECTION( "Test std::copy, vector growth and memcpy preserve every value" )
+    {
+        std::vector<value> values;
+        for (long long i = -1000; i < 1000; ++i) {
+            values.push_back(value{i * 7919});
+        }
+
+        std::vector<value> copies(values.size());
+        std::copy(values.begin(), values.end(), copies.begin());
+
+        long long raw[2000];
+        std::memcpy(raw, values.data(), sizeof(raw));
+
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            const long long expected = (static_cast<long long>(i) - 1000) * 7919;
+
+            CHECK_CASE( expected == (long long)copies[i], "std::copy at " << i );
+            CHECK_CASE( expected == raw[i], "memcpy at " << i );
+        }
+    }
+
+    SECTION( "Test self assignment and assignment from the raw type" )
+    {
+        value x{42LL};
+        value& alias = x;
+
+        x = alias;
+        REQUIRE( 42 == (long long)x );
+
+        x = 7;
+        REQUIRE( 7 == (long long)x );
+    }
+}
+
+TEST_CASE( "Test numerical property methods", "[Integral<T>]")
+{
+    csp::Integral<long long> value{12LL};
+
+    SECTION( "Test odd method" )
+    {
+        bool test = value.odd();
+
+        REQUIRE( false == test );
+    }
+
+    SECTION( "Test even method" )
+    {
+        bool test = value.even();
+
+        REQUIRE( true == test );
+    }
+}
+
+namespace {
+
+// Checks the bit manipulation results against one bit at a time
+// computations on the bit pattern of random values and zero
+template<typename T>
+void checkBits(std::mt19937_64& engine)
+{
+    using U = typename csp::Integral<T>::value_type;
+    const int bits = int(sizeof(T) * 8);
+
+    for (int i = 0; i < 4096; ++i) {
+        const auto random = (i % 512) ? (engine() | ((unsigned __int128)engine() << 64)) >> (engine() % 128)
+                                      : (unsigned __int128)0;
+        const csp::Integral<U> value{U(random)};
+        const auto pattern = (unsigned __int128)random & (~(unsigned __int128)0 >> (128 - bits));
+        const auto bit = [&](int index) { return int(pattern >> index) & 1; };
+
+        int ones = 0, leading = 0, trailing = 0;
+        unsigned __int128 reversed = 0, swapped = 0;
+        for (int index = 0; index < bits; ++index) {
+            ones     += bit(index);
+            reversed |= (unsigned __int128)bit(index) << (bits - 1 - index);
+        }
+        for (int index = bits - 1; (index >= 0) && !bit(index); --index) ++leading;
+        for (int index = 0; (index < bits) && !bit(index); ++index) ++trailing;
+        for (int byte = 0; byte < bits / 8; ++byte) {
+            swapped |= ((pattern >> (byte * 8)) & 0xFF) << (bits - 8 - byte * 8);
+        }
+
+        const int width = bits - leading;
+        const int shift = int(engine() % (3 * bits)) - bits;
+        const unsigned left = unsigned(shift) % unsigned(bits);
+        const auto rotated = left ? ((pattern << left) | (pattern >> (bits - left))) : pattern;
+
+        const auto operand = [&] {
+            std::ostringstream out;
+            out << typeName<T>() << " " << value << ", shift " << shift << ": ";
+            return out.str();
+        };
+
+        CHECK_CASE( ones == value.popcount(), operand() << "popcount" );
+        CHECK_CASE( leading == value.countl_zero(), operand() << "countl_zero" );
+        CHECK_CASE( trailing == value.countr_zero(), operand() << "countr_zero" );
+        CHECK_CASE( width == value.bit_width(), operand() << "bit_width" );
+        CHECK_CASE( U(width ? (unsigned __int128)1 << (width - 1) : 0) == U(value.bit_floor()), operand() << "bit_floor" );
+        CHECK_CASE( U(reversed) == U(value.bit_reverse()), operand() << "bit_reverse" );
+        CHECK_CASE( U(swapped) == U(value.byteswap()), operand() << "byteswap" );
+        CHECK_CASE( U(rotated) == U(value.rotl(shift)), operand() << "rotl" );
+        CHECK_CASE( U(rotated) == U(value.rotr(-shift)), operand() << "rotr" );
+        CHECK_CASE( U(pattern) == U(value.byteswap().byteswap()), operand() << "byteswap twice" );
+        CHECK_CASE( U(pattern) == U(value.rotr(shift).rotl(shift)), operand() << "rotr then rotl" );
+    }
+}
+
+} //< namespace
+
+TEST_CASE( "Test bit manipulation methods", "[Integral<T>]" )
+{
+    std::mt19937_64 engine{99};
+
+    SECTION( "Test every width against one bit at a time computations" )
+    {
+        checkBits<signed char>(engine);
+        checkBits<unsigned char>(engine);
+        checkBits<short>(engine);
+        checkBits<unsigned short>(engine);
+        checkBits<int>(engine);
+        checkBits<unsigned>(engine);
+        checkBits<long long>(engine);
+        checkBits<unsigned long long>(engine);
+        checkBits<__int128>(engine);
+        checkBits<unsigned __int128>(engine);
+    }
+
+    SECTION( "Test powers of two and evaluation at compile time" )
+    {
+        using u8 = csp::Integral<std::uint8_t>;
+
+        static_assert( 1 == int(u8{0}.bit_ceil()), "ceil of zero" );
+        static_assert( 1 == int(u8{1}.bit_ceil()), "ceil of one" );
+        static_assert( 128 == int(u8{128}.bit_ceil()), "ceil of power" );
+        static_assert( 0 == int(u8{129}.bit_ceil()), "ceil not representable" );
+        static_assert( 0 == int(u8{0}.bit_floor()), "floor of zero" );
+        static_assert( 8 == u8{0}.countl_zero() && 8 == u8{0}.countr_zero(), "zero" );
+        static_assert( 0x12345678u == unsigned(csp::Integral<unsigned>{0x78563412u}.byteswap()), "byteswap" );
+        static_assert( 32 == csp::Integral<int>{-1}.popcount(), "signed" );
+
+        REQUIRE( 64 == int(csp::Integral<int>{33}.bit_ceil()) );
+        REQUIRE( int(0x80000000u) == int(csp::Integral<int>{1}.rotr(1)) );
+    }
+}
+
+TEST_CASE( "Test bit deposit, extraction and Morton keys", "[Integral<T>]" )
+{
+    using u64 = csp::Integral<std::uint64_t>;
+    using u32 = csp::Integral<std::uint32_t>;
+
+    std::mt19937_64 engine{2024};
+
+    SECTION( "Test deposit and extraction against one bit at a time loops" )
+    {
+        for (int i = 0; i < 10000; ++i) {
+            const std::uint64_t value = engine();
+            const std::uint64_t mask  = engine() & engine() & (~0ULL >> (engine() % 64));
+
+            std::uint64_t deposited = 0, extracted = 0;
+            for (int bit = 0, next = 0; bit < 64; ++bit) {
+                if ((mask >> bit) & 1u) {
+                    deposited |= ((value >> next) & 1u) << bit;
+                    extracted |= ((value >> bit) & 1u) << next;
+                    ++next;
+                }
+            }
+
+            CHECK_CASE( deposited == std::uint64_t(u64{value}.deposit_bits(mask)), "deposit_bits " << std::hex << value << ", mask " << mask );
+            CHECK_CASE( extracted == std::uint64_t(u64{value}.extract_bits(mask)), "extract_bits " << std::hex << value << ", mask " << mask );
+            CHECK_CASE( deposited == csp::detail::depositBitsPortable(value, mask), "depositBitsPortable " << std::hex << value << ", mask " << mask );
+            CHECK_CASE( extracted == csp::detail::extractBitsPortable(value, mask), "extractBitsPortable " << std::hex << value << ", mask " << mask );
+            CHECK_CASE( (extracted & ((1u << __builtin_popcountll(mask & 0xFFFFu)) - 1u)) ==
+                        std::uint16_t(csp::Integral<std::uint16_t>{std::uint16_t(value)}.extract_bits(std::uint16_t(mask))),
+                        "uint16 extract_bits " << std::hex << value << ", mask " << mask );
+        }
+    }
+
+    SECTION( "Test Morton keys against one bit at a time interleaving" )
+    {
+        for (int i = 0; i < 10000; ++i) {
+            const std::uint32_t x = std::uint32_t(engine());
+            const std::uint32_t y = std::uint32_t(engine());
+            const std::uint32_t z = std::uint32_t(engine()) & 0x1FFFFFu;
+
+            std::uint64_t planar = 0, spatial = 0;
+            for (int bit = 0; bit < 32; ++bit) {
+                planar |= std::uint64_t((x >> bit) & 1u) << (2 * bit);
+                planar |= std::uint64_t((y >> bit) & 1u) << (2 * bit + 1);
+            }
+            for (int bit = 0; bit < 21; ++bit) {
+                spatial |= std::uint64_t((x >> bit) & 1u) << (3 * bit);
+                spatial |= std::uint64_t((y >> bit) & 1u) << (3 * bit + 1);
+                spatial |= std::uint64_t((z >> bit) & 1u) << (3 * bit + 2);
+            }
+
+            const auto plane = csp::morton_decode<2>(planar);
+            const auto space = csp::morton_decode<3>(spatial);
+
+            CHECK_CASE( planar == std::uint64_t(csp::morton_encode(x, y)), "morton_encode " << x << ", " << y );
+            CHECK_CASE( spatial == std::uint64_t(csp::morton_encode(x, y, z)), "morton_encode " << x << ", " << y << ", " << z );
+            CHECK_CASE( (x == std::uint32_t(plane[0])) && (y == std::uint32_t(plane[1])), "morton_decode<2> " << planar );
+            CHECK_CASE( ((x & 0x1FFFFFu) == std::uint32_t(space[0])) && ((y & 0x1FFFFFu) == std::uint32_t(space[1]))
+                        && (z == std::uint32_t(space[2])), "morton_decode<3> " << spatial );
+        }
+    }
+
+    SECTION( "Test evaluation at compile time" )
+    {
+        static_assert( 0xB0 == std::uint64_t(u64{0xB}.deposit_bits(0xF0F0)), "deposit" );
+        static_assert( 0xAA == std::uint64_t(u64{0xA0A0}.extract_bits(0xF0F0)), "extract" );
+        static_assert( 0x27 == std::uint64_t(csp::morton_encode(3u, 5u)), "2D key" );
+        static_assert( 0x1FFFFF == std::uint32_t(csp::morton_decode<3>(csp::morton_encode(0x1FFFFFu, 0u, 1u))[0]), "3D key" );
+
+        REQUIRE( 5 == std::uint32_t(csp::morton_decode<2>(csp::morton_encode(u32{3}, u32{5}))[1]) );
+    }
+}
+
+namespace {
+
+// Checks the integer math results against naive computations on 128-bit
+// integers
+template<typename T>
+void checkMath(std::mt19937_64& engine)
+{
+    using wide = __int128;
+
+    for (int i = 0; i < 2000; ++i) {
+        const T a = T(engine() >> (engine() % 64));
+        const T b = T(engine() >> (engine() % 64));
+        const csp::Integral<T> x{a}, y{b};
+        const unsigned __int128 magnitude_a = a < 0 ? -wide(a) : wide(a);
+        const unsigned __int128 magnitude_b = b < 0 ? -wide(b) : wide(b);
+        const auto operands = [&] {
+            std::ostringstream out;
+            out << typeName<T>() << " a = " << x << ", b = " << y << ": ";
+            return out.str();
+        };
+
+        // Square roots, checked at the value and at the edges of its root
+        const unsigned __int128 root = (unsigned __int128)(std::uint64_t)x.isqrt();
+        CHECK_CASE( (a < 0) || ((root * root <= magnitude_a) && ((root + 1) * (root + 1) > magnitude_a)), operands() << "isqrt(a)" );
+        CHECK_CASE( (a >= 0) || (0 == (long long)(x.isqrt())), operands() << "isqrt(a)" );
+        if ((a > 0) && (root > 1)) {
+            CHECK_CASE( (long long)(root - 1) == (long long)(csp::Integral<T>{T(root * root - 1)}.isqrt()), operands() << "isqrt(isqrt(a)^2 - 1)" );
+        }
+
+        int log2 = -1, log10 = -1;
+        for (unsigned __int128 power = 1; (a > 0) && (power <= magnitude_a); power <<= 1) ++log2;
+        for (unsigned __int128 power = 1; (a > 0) && (power <= magnitude_a); power *= 10) ++log10;
+        CHECK_CASE( log2 == x.ilog2(), operands() << "ilog2(a)" );
+        CHECK_CASE( log10 == x.ilog10(), operands() << "ilog10(a)" );
+
+        // Powers, whose exact value is tracked until it leaves the range of T
+        const unsigned exponent = unsigned(engine() % 8);
+        wide exact = 1;
+        unsigned __int128 modular = 1;
+        bool overflow = false;
+        for (unsigned k = 0; k < exponent; ++k) {
+            modular *= (unsigned __int128)wide(a);
+            if (!overflow) {
+                overflow = __builtin_mul_overflow(exact, wide(a), &exact) ||
+                           (exact > wide(csp::Integral<T>::max())) || (exact < wide(csp::Integral<T>::min()));
+            }
+        }
+        const auto power = csp::Integral<T, csp::overflow::Checked>{a}.ipow(exponent);
+        CHECK_CASE( overflow == power.overflow(), operands() << "ipow(a, " << exponent << ") overflow" );
+        CHECK_CASE( T(modular) == T(power.wrapped()), operands() << "ipow(a, " << exponent << ")" );
+
+        // Common divisors and multiples of the magnitudes
+        unsigned __int128 divisor = magnitude_a, remainder = magnitude_b;
+        while (remainder != 0) {
+            const unsigned __int128 next = divisor % remainder;
+            divisor   = remainder;
+            remainder = next;
+        }
+        const unsigned __int128 multiple = divisor ? magnitude_a / divisor * magnitude_b : 0;
+        const auto common = lcm(csp::Integral<T, csp::overflow::Checked>{a},
+                                csp::Integral<T, csp::overflow::Checked>{b});
+        CHECK_CASE( T(divisor) == T(gcd(x, y)), operands() << "gcd(a, b)" );
+        CHECK_CASE( (multiple > (unsigned __int128)csp::Integral<T>::max()) == common.overflow(), operands() << "lcm(a, b) overflow" );
+        CHECK_CASE( common.overflow() || (T(multiple) == T(common.value())), operands() << "lcm(a, b)" );
+    }
+}
+
+} //< namespace
+
+TEST_CASE( "Test integer math methods", "[Integral<T>]" )
+{
+    std::mt19937_64 engine{31337};
+
+    SECTION( "Test every width against naive computations" )
+    {
+        checkMath<signed char>(engine);
+        checkMath<unsigned char>(engine);
+        checkMath<short>(engine);
+        checkMath<unsigned short>(engine);
+        checkMath<int>(engine);
+        checkMath<unsigned>(engine);
+        checkMath<long long>(engine);
+        checkMath<unsigned long long>(engine);
+    }
+
+    SECTION( "Test edge cases and evaluation at compile time" )
+    {
+        using u64 = csp::Integral<std::uint64_t>;
+        using saturating = csp::Integral<int, csp::overflow::Saturating>;
+
+        static_assert( 4294967295u == std::uint64_t(u64{~0ULL}.isqrt()), "largest root" );
+        static_assert( 3037000499u == std::uint64_t(u64{9223372036854775807ULL}.isqrt()), "root" );
+        static_assert( 19 == u64{~0ULL}.ilog10() && 63 == u64{~0ULL}.ilog2(), "logarithms" );
+        static_assert( -1 == u64{0}.ilog2() && -1 == u64{0}.ilog10(), "logarithms of zero" );
+        static_assert( 1 == int(csp::Integral<int>{0}.ipow(0)), "zero to the zero" );
+        static_assert( -27 == int(csp::Integral<int>{-3}.ipow(3)), "odd power" );
+        static_assert( 0 == int(gcd(csp::Integral<int>{0}, csp::Integral<int>{0})), "gcd of zeros" );
+        static_assert( 6 == int(gcd(csp::Integral<int>{-12}, csp::Integral<int>{18})), "gcd" );
+        static_assert( 12 == int(lcm(csp::Integral<int>{-4}, csp::Integral<int>{6})), "lcm" );
+
+        REQUIRE( INT_MIN == int(saturating{-3}.ipow(41)) );
+        REQUIRE( INT_MAX == int(saturating{-3}.ipow(40)) );
+        REQUIRE( u64{18446744073709551615ULL} == u64{~0ULL}.isqrt().ipow(2) + u64{2} * u64{~0ULL}.isqrt() );
+        REQUIRE( (std::uint64_t(1) << 32) - 1 == std::uint64_t(u64{(std::uint64_t(1) << 32) * ((std::uint64_t(1) << 32) - 1)}.isqrt()) );
+        REQUIRE( "340282366920938463463374607431768211455" == csp::Integral<unsigned __int128>{~(unsigned __int128)0}.dec() );
+        REQUIRE( 38 == csp::Integral<unsigned __int128>{~(unsigned __int128)0}.ilog10() );
+        REQUIRE( u64{~0ULL} == u64{std::uint64_t(csp::Integral<unsigned __int128>{~(unsigned __int128)0}.isqrt())} );
+    }
+}
+
+TEST_CASE( "Test user defined literals", "[Integral<T>]" )
+{
+    using namespace compuSUAVE_Professional;
+
+    SECTION( "Test unsigned char type" )
+    {
+        auto object = 65_cspiuc;
+
+        REQUIRE( 'A' == char(object) );
+    }
+
+    SECTION( "Test unsigned short type" )
+    {
+        auto object = 97_cspius;
+
+        REQUIRE( 'a' == short(object) );
+    }
+
+    SECTION( "Test unsigned int type" )
+    {
+        auto object = 0_cspiui;
+
+        REQUIRE( '\0' == unsigned(object) );
+    }
+
+    SECTION( "Test unsigned long type" )
+    {
+        auto object = 100_cspiul;
+
+        REQUIRE( 100 == long(object) );
+    }
+
+    SECTION( "Test unsigned long long type" )
+    {
+        auto object = 12345_cspiull;
+
+        REQUIRE( 12345 == long(object) );
+    }
+
+    SECTION( "Test signed types" )
+    {
+        auto c = -128_cspis;
+        auto i = -2'147'483'647_cspii;
+        auto l = 0x7fff'ffff'ffff'ffff_cspill;
+
+        REQUIRE( (std::is_same<decltype(c), Integral<short>>::value) );
+        REQUIRE( (std::is_same<decltype(i), Integral<int>>::value) );
+        REQUIRE( -128 == short(c) );
+        REQUIRE( -2147483647 == int(i) );
+        REQUIRE( std::numeric_limits<long long>::max() == (long long)(l) );
+        REQUIRE( 127 == int((signed char)(127_cspic)) );
+    }
+
+    SECTION( "Test radix prefixes at compile time" )
+    {
+        static_assert( 255 == unsigned(0xff_cspiuc), "hexadecimal literal" );
+        static_assert( 0xBEEF == unsigned(0XBEEF_cspius), "hexadecimal literal" );
+        static_assert( 10 == unsigned(0b1010_cspiui), "binary literal" );
+        static_assert( 0x0f0f == unsigned(0B0000'1111'0000'1111_cspius),
+                       "binary literal with separators" );
+        static_assert( 0755 == unsigned(0755_cspiui), "octal literal" );
+        static_assert( 0 == int(0_cspii), "zero literal" );
+        static_assert( 18446744073709551615ull ==
+                       (unsigned long long)(18446744073709551615_cspiull),
+                       "largest literal" );
+
+        using detail::parseLiteral;
+        static_assert( !parseLiteral<'0', '8'>().valid, "octal digit" );
+        static_assert( !parseLiteral<'0', 'b', '2'>().valid, "binary digit" );
+        static_assert( !parseLiteral<'1', '.', '5'>().valid, "floating point" );
+        static_assert( !parseLiteral<'1', 'e', '3'>().valid, "exponent" );
+        static_assert( parseLiteral<'3', '4', '0', '2', '8', '2', '3', '6', '6',
+                                    '9', '2', '0', '9', '3', '8', '4', '6', '3',
+                                    '4', '6', '3', '3', '7', '4', '6', '0', '7',
+                                    '4', '3', '1', '7', '6', '8', '2', '1', '1',
+                                    '4', '5', '6'>().overflow, "beyond 128 bits" );
+    }
+}
+
+namespace {
+
+// Checks the element-wise results of IntegralArray against the same
+// operation on the raw values, over lengths around every vector width
+template<typename T>
+void checkArrays(std::mt19937_64& engine)
+{
+    using U     = typename std::make_unsigned<T>::type;
+    using array = csp::IntegralArray<T>;
+
+    for (std::size_t size : { 0, 1, 7, 15, 16, 17, 31, 33, 63, 64, 65, 127, 129, 1000 }) {
+        std::vector<T> a(size), b(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            a[i] = T(engine() >> (engine() % 64));
+            b[i] = (i % 5 == 0) ? a[i] : T(engine() >> (engine() % 64));
+        }
+        const T scalar = size ? b[size / 2] : T(3);
+
+        const array lhs(a.begin(), a.end());
+        const array rhs(b.begin(), b.end());
+        const array shorter(b.begin(), b.begin() + size / 2);
+
+        const auto operands = [&](const std::size_t i) {
+            std::ostringstream out;
+            out << typeName<T>() << " x" << size << " at " << i << ": a = " << shown(a[i])
+                << ", b = " << shown(b[i]) << ", scalar = " << shown(scalar) << ", ";
+            return out.str();
+        };
+
+        CHECK_CASE( (reinterpret_cast<std::uintptr_t>(lhs.data()) % array::alignment) == 0, typeName<T>() << " x" << size << " alignment" );
+
+        const array sum = lhs + rhs, difference = lhs - rhs, product = lhs * rhs;
+        const array lesser = min(lhs, rhs), greater = max(lhs, rhs);
+        const array shifted = lhs + csp::Integral<T>{scalar};
+        const array scaled = lhs * csp::Integral<T>{scalar};
+        const csp::IntegralMask equal = mask_eq(lhs, rhs);
+        const csp::IntegralMask less = mask_lt(lhs, rhs);
+        const csp::IntegralMask above = mask_gt(lhs, csp::Integral<T>{scalar});
+
+        for (std::size_t i = 0; i < size; ++i) {
+            CHECK_CASE( T(sum[i])        == T(U(U(a[i]) + U(b[i]))), operands(i) << "a + b" );
+            CHECK_CASE( T(difference[i]) == T(U(U(a[i]) - U(b[i]))), operands(i) << "a - b" );
+            CHECK_CASE( T(product[i])    == T(U(U(a[i]) * U(b[i]))), operands(i) << "a * b" );
+            CHECK_CASE( T(lesser[i])     == std::min(a[i], b[i]), operands(i) << "min(a, b)" );
+            CHECK_CASE( T(greater[i])    == std::max(a[i], b[i]), operands(i) << "max(a, b)" );
+            CHECK_CASE( T(shifted[i])    == T(U(U(a[i]) + U(scalar))), operands(i) << "a + scalar" );
+            CHECK_CASE( T(scaled[i])     == T(U(U(a[i]) * U(scalar))), operands(i) << "a * scalar" );
+            CHECK_CASE( equal[i] == (a[i] == b[i]), operands(i) << "mask_eq(a, b)" );
+            CHECK_CASE( less[i]  == (a[i] < b[i]), operands(i) << "mask_lt(a, b)" );
+            CHECK_CASE( above[i] == (a[i] > scalar), operands(i) << "mask_gt(a, scalar)" );
+        }
+
+        INFO( typeName<T>() << " x" << size );
+        CHECK( equal.size() == size );
+        CHECK( sum.size() == size );
+        CHECK( equal.count() == std::size_t(std::count_if(a.begin(), a.end(),
+                                    [&](const T& x) { return x == b[&x - a.data()]; })) );
+        CHECK( (lhs + shorter).size() == shorter.size() );
+        CHECK( mask_lt(lhs, shorter).size() == shorter.size() );
+        CHECK( (~equal).count() == size - equal.count() );
+        CHECK( (equal & less).count() == 0 );
+        CHECK( (equal | less).count() == equal.count() + less.count() );
+
+#if defined(INTEGRAL_CSP_X86)
+        // Every instruction set kernel the processor runs, not only the
+        // widest that dispatch selects
+        using operand = csp::detail::ArrayOperand<T, csp::overflow::Wrapping>;
+        const auto& features = csp::detail::cpuFeatures();
+        std::vector<csp::Integral<T>> out(size);
+        std::vector<std::uint64_t> words(size / 64 + 1);
+
+        const char* const isas[] = { "SSE2", "AVX2", "AVX-512" };
+        for (int isa = 0; isa < 3; ++isa) {
+            if ((isa == 1 && !features.avx2) || (isa == 2 && !features.avx512bw)) {
+                continue;
+            }
+            switch (isa) {
+            case 0:
+                csp::detail::mapSse2<csp::detail::SubLanes>(lhs.data(), operand{rhs.data()}, out.data(), size);
+                csp::detail::maskSse2<csp::detail::LessLanes>(lhs.data(), operand{rhs.data()}, words.data(), size);
+                break;
+            case 1:
+                csp::detail::mapAvx2<csp::detail::SubLanes>(lhs.data(), operand{rhs.data()}, out.data(), size);
+                csp::detail::maskAvx2<csp::detail::LessLanes>(lhs.data(), operand{rhs.data()}, words.data(), size);
+                break;
+            default:
+                csp::detail::mapAvx512<csp::detail::SubLanes>(lhs.data(), operand{rhs.data()}, out.data(), size);
+                csp::detail::maskAvx512<csp::detail::LessLanes>(lhs.data(), operand{rhs.data()}, words.data(), size);
+            }
+            for (std::size_t i = 0; i < size; ++i) {
+                CHECK_CASE( T(out[i]) == T(difference[i]), operands(i) << isas[isa] << " a - b" );
+                CHECK_CASE( bool((words[i / 64] >> (i % 64)) & 1) == less[i], operands(i) << isas[isa] << " mask_lt(a, b)" );
+            }
+        }
+#endif
+    }
+}
+
+} //< namespace
+
+TEST_CASE( "Test element-wise operations of IntegralArray", "[IntegralArray<T>]" )
+{
+    std::mt19937_64 engine{2024};
+
+    SECTION( "Test every operation, lane width and tail length against raw values" )
+    {
+        checkArrays<signed char>(engine);
+        checkArrays<unsigned char>(engine);
+        checkArrays<short>(engine);
+        checkArrays<unsigned short>(engine);
+        checkArrays<int>(engine);
+        checkArrays<unsigned>(engine);
+        checkArrays<long long>(engine);
+        checkArrays<unsigned long long>(engine);
+    }
+
+    SECTION( "Test construction, copies and compound assignment" )
+    {
+        csp::IntegralArray<int> values{1, 2, 3, 4, 5};
+        csp::IntegralArray<int> copy = values;
+
+        copy *= csp::Integral<int>{10};
+        copy -= values;
+        values += copy;
+
+        REQUIRE( 5 == values.size() );
+        REQUIRE( 10 == int(values[0]) );
+        REQUIRE( 50 == int(values[4]) );
+        REQUIRE( 9 == int(copy[0]) );
+
+        csp::IntegralArray<int> prefix{1, 2, 3};
+        prefix += csp::IntegralArray<int>{10, 20};
+
+        REQUIRE( 3 == prefix.size() );
+        REQUIRE( 22 == int(prefix[1]) );
+        REQUIRE( 3 == int(prefix[2]) );
+
+        csp::IntegralArray<int> moved = std::move(values);
+        REQUIRE( 5 == moved.size() );
+        REQUIRE( values.empty() );
+        REQUIRE( 3 == csp::IntegralArray<int>(3).size() );
+        REQUIRE( 0 == int(csp::IntegralArray<int>(3)[2]) );
+        REQUIRE( 7 == int(csp::IntegralArray<int>(4, csp::Integral<int>{7})[3]) );
+        REQUIRE( 4 == csp::IntegralArray<int>(4, 7).size() );
+        REQUIRE( 7 == int(csp::IntegralArray<int>(4, 7)[3]) );
+    }
+
+    SECTION( "Test arithmetic wraps around instead of applying the policy" )
+    {
+        csp::IntegralArray<signed char> values(100, csp::Integral<signed char>{127});
+        values += csp::Integral<signed char>{1};
+
+        REQUIRE( 100 == mask_eq(values, csp::Integral<signed char>{-128}).count() );
+    }
+}
+
+namespace {
+
+// Checks the reductions against a loop over the raw values, for the
+// dispatched kernels and every instruction set kernel the processor runs;
+// sums of 64-bit types are 128-bit and compared without decomposition
+template<typename T>
+void checkReductions(std::mt19937_64& engine)
+{
+    using U        = typename std::make_unsigned<T>::type;
+    using integral = csp::Integral<T>;
+    using total    = csp::detail::SumTotal<T>;
+
+    for (std::size_t size : { 0, 1, 3, 15, 16, 17, 63, 64, 65, 255, 256, 257, 1000, 4099 }) {
+        std::vector<integral> values(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            values[i] = integral{(i % 7 == 0) ? std::numeric_limits<T>::max()
+                                              : T(engine() >> (engine() % 64))};
+        }
+
+        total sum = 0;
+        T least = std::numeric_limits<T>::max(), greatest = std::numeric_limits<T>::min();
+        std::uint64_t bits = 0;
+        std::vector<std::size_t> digits(256), counts(256, 1);
+        for (const integral& value : values) {
+            sum     += T(value);
+            least    = std::min(least, T(value));
+            greatest = std::max(greatest, T(value));
+            bits    += __builtin_popcountll((unsigned long long)U(T(value)));
+            ++digits[(U(T(value)) >> (sizeof(T) * 8 - 8)) & 0xFF];
+        }
+
+        const integral* first = values.data();
+        const integral* last  = first + size;
+        INFO( typeName<T>() << " x" << size << ", sum " << shown(sum) );
+
+        CHECK( (total(csp::reduce_sum(first, last)) == sum) );
+        CHECK( T(csp::reduce_min(first, last)) == least );
+        CHECK( T(csp::reduce_max(first, last)) == greatest );
+        CHECK( csp::reduce_popcount(first, last) == bits );
+
+        csp::radix_histogram(first, last, sizeof(T) * 8 - 8, 8, counts.data());
+        for (std::size_t digit = 0; digit < 256; ++digit) {
+            CHECK_CASE( counts[digit] == digits[digit] + 1, "radix_histogram digit " << digit );
+        }
+
+#if defined(INTEGRAL_CSP_X86)
+        const auto& features = csp::detail::cpuFeatures();
+        const auto* bytes = reinterpret_cast<const unsigned char*>(first);
+        using sum_kernel = csp::detail::SumKernel;
+        using min_kernel = csp::detail::ExtremeKernel<csp::detail::MinLanes>;
+        using popcount_kernel = csp::detail::PopcountKernel;
+
+        CHECK( (csp::detail::reduceSse2<sum_kernel>(first, size) == sum) );
+        CHECK( csp::detail::reduceSse2<min_kernel>(first, size, std::numeric_limits<T>::max()) == least );
+        CHECK( csp::detail::reduceSse2<popcount_kernel>(bytes, size * sizeof(T)) == bits );
+        if (features.avx2) {
+            CHECK( (csp::detail::reduceAvx2<sum_kernel>(first, size) == sum) );
+            CHECK( csp::detail::reduceAvx2<min_kernel>(first, size, std::numeric_limits<T>::max()) == least );
+            CHECK( csp::detail::reduceAvx2<popcount_kernel>(bytes, size * sizeof(T)) == bits );
+        }
+        if (features.avx512bw) {
+            CHECK( (csp::detail::reduceAvx512<sum_kernel>(first, size) == sum) );
+            CHECK( csp::detail::reduceAvx512<min_kernel>(first, size, std::numeric_limits<T>::max()) == least );
+            CHECK( csp::detail::reduceAvx512<popcount_kernel>(bytes, size * sizeof(T)) == bits );
+        }
+#endif
+    }
+}
+
+} //< namespace
+
+TEST_CASE( "Test reductions over ranges of Integral objects", "[Integral<T>]" )
+{
+    std::mt19937_64 engine{4242};
+
+    SECTION( "Test every reduction and lane width against raw values" )
+    {
+        checkReductions<signed char>(engine);
+        checkReductions<unsigned char>(engine);
+        checkReductions<short>(engine);
+        checkReductions<unsigned short>(engine);
+        checkReductions<int>(engine);
+        checkReductions<unsigned>(engine);
+        checkReductions<long long>(engine);
+        checkReductions<unsigned long long>(engine);
+    }
+
+    SECTION( "Test sums widen beyond the range of the lanes and of T" )
+    {
+        const std::vector<csp::Integral<unsigned short>> narrow(5000001, csp::Integral<unsigned short>{65535});
+        const std::vector<csp::Integral<short>> negative(5000001, csp::Integral<short>{-32768});
+        const std::vector<csp::Integral<unsigned long long>> wide(1001, csp::Integral<unsigned long long>{~0ull});
+        const std::vector<csp::Integral<long long>> minus(1001, csp::Integral<long long>{-1});
+
+        REQUIRE( 65535ull * 5000001 == (unsigned long long)csp::reduce_sum(narrow.data(), narrow.data() + narrow.size()) );
+        REQUIRE( -32768ll * 5000001 == (long long)csp::reduce_sum(negative.data(), negative.data() + negative.size()) );
+        REQUIRE( ((unsigned __int128)(~0ull) * 1001 ==
+                  (unsigned __int128)csp::reduce_sum(wide.data(), wide.data() + wide.size())) );
+        REQUIRE( -1001 == (long long)csp::reduce_sum(minus.data(), minus.data() + minus.size()) );
+    }
+
+    SECTION( "Test empty ranges yield the identities and arrays reduce as ranges" )
+    {
+        const csp::Integral<int>* none = nullptr;
+        const csp::IntegralArray<int> values{4, -9, 16, 25};
+
+        REQUIRE( 0 == (long long)csp::reduce_sum(none, none) );
+        REQUIRE( std::numeric_limits<int>::max() == int(csp::reduce_min(none, none)) );
+        REQUIRE( std::numeric_limits<int>::min() == int(csp::reduce_max(none, none)) );
+        REQUIRE( 36 == (long long)csp::reduce_sum(values.begin(), values.end()) );
+        REQUIRE( -9 == int(csp::reduce_min(values.begin(), values.end())) );
+        REQUIRE( 25 == int(csp::reduce_max(values.begin(), values.end())) );
+    }
+}
+
+namespace {
+
+// Random bits filling every bit of T, 128-bit types included
+template<typename T>
+T randomBits(std::mt19937_64& engine)
+{
+    return (sizeof(T) > 8) ? T(((unsigned __int128)engine() << 64) | engine()) : T(engine());
+}
+
+// Keys of the sort tests: uniform, few distinct, magnitudes of every width
+// with either sign, descending and all equal, the last two leaving digits
+// uniform, then clustered in the low 5/8 of the bits and around zero
+const char* const sortDistributions[] = { "uniform", "few distinct", "mixed magnitudes",
+                                          "descending", "all minimum", "clustered low",
+                                          "clustered around zero" };
+const int sortDistributionCount = 7;
+
+template<typename T>
+std::vector<T> sortKeys(std::mt19937_64& engine, const std::size_t size, const int distribution)
+{
+    using U = csp::detail::MakeUnsigned<T>;
+    const unsigned bits = unsigned(sizeof(T) * 8);
+
+    std::vector<T> keys(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        switch (distribution) {
+        case 0:  keys[i] = randomBits<T>(engine); break;
+        case 1:  keys[i] = T(engine() % 7); break;
+        case 2:  keys[i] = T(T(U(randomBits<T>(engine)) >> (1 + engine() % (bits - 1))) * ((engine() % 2) ? 1 : -1)); break;
+        case 3:  keys[i] = T(size - i); break;
+        case 4:  keys[i] = std::numeric_limits<T>::min(); break;
+        case 5:  keys[i] = T(U(randomBits<T>(engine)) >> (bits - bits * 5 / 8)); break;
+        default: keys[i] = T(int(engine() % 2001) - 1000); break;
+        }
+    }
+    return keys;
+}
+
+// Position of the first element of a sorted range that differs from the
+// expected order, the size of the range if none does
+template<typename T, typename Element>
+std::size_t firstDifference(const std::vector<T>& expected, const std::vector<Element>& sorted)
+{
+    std::size_t index = 0;
+    while ((index < expected.size()) && (expected[index] == T(sorted[index]))) {
+        ++index;
+    }
+    return index;
+}
+
+// Checks integral_sort against std::sort on the raw values, over lengths
+// around the insertion sort limit and over every key distribution
+template<typename T>
+void checkSort(std::mt19937_64& engine, const std::size_t large)
+{
+    for (std::size_t size : { std::size_t(0), std::size_t(1), std::size_t(2), std::size_t(63),
+                              std::size_t(64), std::size_t(65), std::size_t(1000), large }) {
+        for (int distribution = 0; distribution < sortDistributionCount; ++distribution) {
+            std::vector<T> expected = sortKeys<T>(engine, size, distribution);
+            std::vector<csp::Integral<T>> values(expected.begin(), expected.end());
+            std::sort(expected.begin(), expected.end());
+            csp::integral_sort(values.data(), values.data() + size);
+
+            const std::size_t index = firstDifference(expected, values);
+            CHECK_CASE( index == size, typeName<T>() << " x" << size << ", " << sortDistributions[distribution]
+                                       << ": " << values[index] << " at " << index << " instead of "
+                                       << shown(expected[index]) );
+        }
+    }
+}
+
+// Checks the parallel integral_sort against std::sort on the raw values,
+// over every key distribution and numbers of threads below, at and above
+// the number of parts the range allows
+template<typename T>
+void checkParallelSort(std::mt19937_64& engine, const std::size_t size)
+{
+    for (int distribution = 0; distribution < sortDistributionCount; ++distribution) {
+        std::vector<T> expected = sortKeys<T>(engine, size, distribution);
+        const std::vector<csp::Integral<T>> input(expected.begin(), expected.end());
+        std::sort(expected.begin(), expected.end());
+
+        for (std::size_t threads : { std::size_t(0), std::size_t(1), std::size_t(2),
+                                     std::size_t(3), std::size_t(8), std::size_t(64) }) {
+            std::vector<csp::Integral<T>> values(input);
+            csp::integral_sort(values.data(), values.data() + size, threads);
+
+            const std::size_t index = firstDifference(expected, values);
+            CHECK_CASE( index == size, typeName<T>() << " x" << size << ", " << sortDistributions[distribution]
+                                       << ", " << threads << " threads: " << values[index] << " at " << index
+                                       << " instead of " << shown(expected[index]) );
+        }
+    }
+}
+
+// Number of buckets the parallel sort fills with the keys of a range
+template<typename T>
+std::size_t parallelSortBuckets(const std::vector<csp::Integral<T>>& values)
+{
+    using Key = csp::detail::RadixKey<T>;
+    const auto first = values.data();
+    const auto last  = values.data() + values.size();
+
+    const typename Key::type least = Key::of(csp::reduce_min(first, last));
+    const typename Key::type span  = typename Key::type(Key::of(csp::reduce_max(first, last)) - least);
+    const unsigned shift = csp::detail::radixSplitShift<T>(span, 8);
+
+    std::vector<std::size_t> counts(256);
+    csp::detail::radixSplitHistogram(first, last, least, shift, counts.data());
+    return std::size_t(std::count_if(counts.begin(), counts.end(),
+                                     [](std::size_t count) { return count != 0; }));
+}
+
+} //< namespace
+
+TEST_CASE( "Test radix sorting of Integral ranges", "[Integral<T>]" )
+{
+    std::mt19937_64 engine{777};
+
+    SECTION( "Test every width and signedness against std::sort" )
+    {
+        checkSort<signed char>(engine, 5000);
+        checkSort<unsigned char>(engine, 5000);
+        checkSort<short>(engine, 70000);
+        checkSort<unsigned short>(engine, 70000);
+        checkSort<int>(engine, 70000);
+        checkSort<unsigned>(engine, 70000);
+        checkSort<long long>(engine, 70000);
+        checkSort<unsigned long long>(engine, 70000);
+        checkSort<__int128>(engine, 5000);
+        checkSort<unsigned __int128>(engine, 5000);
+    }
+
+    SECTION( "Test the 16-bit digits of the largest 64-bit ranges" )
+    {
+        std::vector<long long> expected = sortKeys<long long>(engine, 70000, 2);
+        std::vector<csp::Integral<long long>> values(expected.begin(), expected.end());
+        std::vector<csp::Integral<long long>> buffer(values.size());
+        std::vector<std::size_t> counts(4 << 16);
+
+        for (unsigned pass = 0; pass < 4; ++pass) {
+            csp::detail::radixHistogram(values.data(), values.data() + values.size(), pass * 16, 16,
+                                        counts.data() + (pass << 16));
+        }
+        const bool swapped = csp::detail::radixSortPasses(values.data(), buffer.data(), values.size(),
+                                                          16, 4, counts.data());
+        const auto& sorted = swapped ? buffer : values;
+        std::sort(expected.begin(), expected.end());
+
+        const std::size_t index = firstDifference(expected, sorted);
+        CHECK_CASE( index == expected.size(), sorted[index] << " at " << index << " instead of " << expected[index] );
+    }
+
+    SECTION( "Test the sort covers the policies and the extremes of T" )
+    {
+        using saturating = csp::Integral<int, csp::overflow::Saturating>;
+        std::vector<saturating> values;
+        for (int i = 0; i < 100; ++i) {
+            values.push_back(saturating{(i % 2) ? std::numeric_limits<int>::max() - i + 1
+                                                : std::numeric_limits<int>::min() + i});
+        }
+        csp::integral_sort(values.data(), values.data() + values.size());
+
+        REQUIRE( std::numeric_limits<int>::min() == int(values.front()) );
+        REQUIRE( std::numeric_limits<int>::max() == int(values.back()) );
+        REQUIRE( std::is_sorted(values.begin(), values.end(),
+                                [](saturating a, saturating b) { return int(a) < int(b); }) );
+    }
+
+    SECTION( "Test the parallel sort matches std::sort for any number of threads" )
+    {
+        checkParallelSort<unsigned char>(engine, 40000);
+        checkParallelSort<short>(engine, 140000);
+        checkParallelSort<int>(engine, 140000);
+        checkParallelSort<unsigned>(engine, 140000);
+        checkParallelSort<long long>(engine, 140000);
+        checkParallelSort<unsigned long long>(engine, 140000);
+        checkParallelSort<__int128>(engine, 70000);
+    }
+
+    SECTION( "Test the parallel sort splits clustered keys over many buckets" )
+    {
+        std::vector<csp::Integral<unsigned long long>> low(70000);
+        for (auto& value : low) {
+            value = csp::Integral<unsigned long long>(engine() >> 24);
+        }
+        std::vector<csp::Integral<long long>> around(70000);
+        for (auto& value : around) {
+            value = csp::Integral<long long>((long long)(engine() % 2001) - 1000);
+        }
+        std::vector<csp::Integral<int>> narrow(70000);
+        for (auto& value : narrow) {
+            value = csp::Integral<int>(int(engine() >> 40));
+        }
+
+        REQUIRE( parallelSortBuckets(low) > 128 );
+        REQUIRE( parallelSortBuckets(around) > 128 );
+        REQUIRE( parallelSortBuckets(narrow) > 128 );
     }
 }
@@ -0,0 +1,553 @@
+/*  Copyright(c) 2015, Rico Antonio Felix. All rights reserved.
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *      1. The origin of this software must not be misrepresented; you must not
+ *      claim that you wrote the original software. If you use this software
+ *      in a product, an acknowledgment in the product documentation would be
+ *      appreciated but is not required.
+ *
+ *      2. Altered source versions must be plainly marked as such, and must not
+ *      be misrepresented as being the original software.
+ *
+ *      3. This notice may not be removed or altered from any source
+ *      distribution.
+ */
+
+ /**
+  * @author Rico Antonio Felix <ricoantoniofelix@yahoo.com>
+  */
+
+#ifndef MOD_INTEGRAL_CSP_H__
+#define MOD_INTEGRAL_CSP_H__
+
+#include "Integral.hpp"
+
+#if !defined(__SIZEOF_INT128__)
+#error "ModIntegral.hpp requires a compiler providing unsigned __int128"
+#endif
+
+namespace compuSUAVE_Professional {
+
+//=========================================================================
+// Implementation Details
+//=========================================================================
+namespace detail {
+
+/*
+ * Word residues are kept in, narrower types are promoted to 32 bits
+ */
+template<typename T>
+using ModularWord = std::conditional_t<(sizeof(T) <= 4), std::uint32_t,
+                                                         std::uint64_t>;
+
+/*
+ * Word holding the full product of two residues
+ */
+template<typename U>
+using ModularWide = std::conditional_t<(sizeof(U) <= 4), std::uint64_t,
+                                                         UInt128>;
+
+/*
+ * Sum of two residues modulo the modulus, the carry out of the word counts
+ * for moduli beyond half the range of the word. Residues are random enough
+ * for a branch to mispredict half of the time, so the flags select the
+ * result arithmetically.
+ */
+template<typename U>
+constexpr U modularAdd(const U lhs, const U rhs, const U modulus) noexcept {
+    U sum = 0;
+    U reduced = 0;
+    const bool carry  = __builtin_add_overflow(lhs, rhs, &sum);
+    const bool borrow = __builtin_sub_overflow(sum, modulus, &reduced);
+    const U keep = static_cast<U>(U{} - static_cast<U>(borrow & !carry));
+    return static_cast<U>((sum & keep) | (reduced & ~keep));
+}
+
+/*
+ * Difference of two residues modulo the modulus
+ */
+template<typename U>
+constexpr U modularSubtract(const U lhs, const U rhs, const U modulus)
+                            noexcept {
+    const U difference = static_cast<U>(lhs - rhs);
+    return (lhs < rhs) ? static_cast<U>(difference + modulus) : difference;
+}
+
+/*
+ * Rejects the moduli a reduction cannot work with
+ */
+template<typename U>
+constexpr U checkModulus(const U modulus, const bool odd) {
+    if (modulus == 0) {
+        throw std::invalid_argument{"compuSUAVE_Professional::ModIntegral: "
+                                    "modulus is zero"};
+    }
+    if (odd && ((modulus & 1u) == 0)) {
+        throw std::invalid_argument{"compuSUAVE_Professional::ModIntegral: "
+                                    "Montgomery modulus is even"};
+    }
+    return modulus;
+}
+
+} //< namespace detail
+
+//=========================================================================
+// Reductions
+//=========================================================================
+
+/**
+ * @brief Runtime modulus reducing products with Montgomery multiplication
+ *
+ * Residues are kept in Montgomery form a * 2^N mod m, N being the width of
+ * the word, which turns the reduction of a product into two multiplications
+ * and a subtraction. Only odd moduli are supported.
+ */
+template<typename T>
+class MontgomeryModulus final {
+
+    static_assert(detail::IntegralTraits<T>::integral &&
+                  !detail::IntegralTraits<T>::is_signed,
+                  "Error instantiating compuSUAVE_Professional::"
+                  "MontgomeryModulus<T>: Found non-unsigned type");
+    static_assert(sizeof(T) <= sizeof(std::uint64_t),
+                  "Error instantiating compuSUAVE_Professional::"
+                  "MontgomeryModulus<T>: Found type wider than the 64-bit word");
+
+public:
+
+    /**
+     * @brief Type of the values reduced
+     */
+    using value_type = T;
+
+    /**
+     * @brief Word the residues are kept in
+     */
+    using word_type = detail::ModularWord<T>;
+
+    /**
+     * @brief Constructor to precompute the reduction for the specified
+     *        modulus
+     *
+     * @param modulus Odd modulus of every operation
+     *
+     * @throws std::invalid_argument If the modulus is even
+     */
+    constexpr explicit MontgomeryModulus(const Integral<T> modulus)
+    : m_modulus{detail::checkModulus(static_cast<word_type>(T(modulus)),
+                                     true)},
+      m_inverse{inverse(m_modulus)},
+      m_square{square(m_modulus)} {}
+
+    /**
+     * @brief Get the modulus
+     */
+    constexpr Integral<T> modulus() const noexcept {
+        return Integral<T>{static_cast<T>(m_modulus)};
+    }
+
+    /**
+     * @brief Converts a value to its residue in Montgomery form
+     */
+    constexpr word_type encode(const word_type value) const noexcept {
+        return reduce(static_cast<Wide>(value % m_modulus) * m_square);
+    }
+
+    /**
+     * @brief Converts a residue in Montgomery form back to its value
+     */
+    constexpr word_type decode(const word_type residue) const noexcept {
+        return reduce(residue);
+    }
+
+    /**
+     * @brief Product of two residues
+     */
+    constexpr word_type multiply(const word_type lhs, const word_type rhs)
+                                 const noexcept {
+        return reduce(static_cast<Wide>(lhs) * rhs);
+    }
+
+    /**
+     * @brief Sum of two residues
+     */
+    constexpr word_type add(const word_type lhs, const word_type rhs)
+                            const noexcept {
+        return detail::modularAdd(lhs, rhs, m_modulus);
+    }
+
+    /**
+     * @brief Difference of two residues
+     */
+    constexpr word_type subtract(const word_type lhs, const word_type rhs)
+                                 const noexcept {
+        return detail::modularSubtract(lhs, rhs, m_modulus);
+    }
+
+private:
+    using Wide = detail::ModularWide<word_type>;
+
+    static constexpr unsigned bits = std::numeric_limits<word_type>::digits;
+
+    /*
+     * Inverse of the modulus modulo 2^N by Newton's iteration, an odd value
+     * is its own inverse modulo 8 and every step doubles the correct bits
+     */
+    static constexpr word_type inverse(const word_type modulus) noexcept {
+        word_type value = modulus;
+        for (unsigned correct = 3; correct < bits; correct *= 2) {
+            value = static_cast<word_type>(value * (2u - modulus * value));
+        }
+        return value;
+    }
+
+    /*
+     * 2^(2N) mod m, from 2^N mod m which is the negated modulus modulo m
+     */
+    static constexpr word_type square(const word_type modulus) noexcept {
+        const word_type power = static_cast<word_type>(
+            static_cast<word_type>(word_type{} - modulus) % modulus);
+        return static_cast<word_type>((static_cast<Wide>(power) * power)
+                                      % modulus);
+    }
+
+    /*
+     * Montgomery reduction of a product below m * 2^N: the low half of the
+     * product of the quotient and the modulus matches the low half of the
+     * value, so only the high halves are subtracted and nothing overflows
+     * for moduli up to 2^N - 1
+     */
+    constexpr word_type reduce(const Wide value) const noexcept {
+        const word_type quotient = static_cast<word_type>(
+            static_cast<word_type>(value) * m_inverse);
+        const word_type high = static_cast<word_type>(value >> bits);
+        const word_type subtrahend = static_cast<word_type>(
+            (static_cast<Wide>(quotient) * m_modulus) >> bits);
+        return detail::modularSubtract(high, subtrahend, m_modulus);
+    }
+
+    word_type m_modulus; //< Modulus of every operation
+    word_type m_inverse; //< Inverse of the modulus modulo 2^N
+    word_type m_square;  //< 2^(2N) mod m, converts into Montgomery form
+
+}; //< MontgomeryModulus<T>
+
+/**
+ * @brief Runtime modulus reducing products with Barrett reduction
+ *
+ * Residues are kept as they are and the quotient of a product by the
+ * modulus is estimated from the high half of its product with a
+ * precomputed reciprocal, off by at most one. Any modulus is supported.
+ */
+template<typename T>
+class BarrettModulus final {
+
+    static_assert(detail::IntegralTraits<T>::integral &&
+                  !detail::IntegralTraits<T>::is_signed,
+                  "Error instantiating compuSUAVE_Professional::"
+                  "BarrettModulus<T>: Found non-unsigned type");
+    static_assert(sizeof(T) <= sizeof(std::uint64_t),
+                  "Error instantiating compuSUAVE_Professional::"
+                  "BarrettModulus<T>: Found type wider than the 64-bit word");
+
+public:
+
+    /**
+     * @brief Type of the values reduced
+     */
+    using value_type = T;
+
+    /**
+     * @brief Word the residues are kept in
+     */
+    using word_type = detail::ModularWord<T>;
+
+    /**
+     * @brief Constructor to precompute the reduction for the specified
+     *        modulus
+     *
+     * @param modulus Modulus of every operation
+     *
+     * @throws std::invalid_argument If the modulus is zero
+     */
+    constexpr explicit BarrettModulus(const Integral<T> modulus)
+    : m_modulus{detail::checkModulus(static_cast<word_type>(T(modulus)),
+                                     false)},
+      m_reciprocal{static_cast<Wide>(~Wide{}) / m_modulus} {}
+
+    /**
+     * @brief Get the modulus
+     */
+    constexpr Integral<T> modulus() const noexcept {
+        return Integral<T>{static_cast<T>(m_modulus)};
+    }
+
+    /**
+     * @brief Converts a value to its residue
+     */
+    constexpr word_type encode(const word_type value) const noexcept {
+        return reduce(value);
+    }
+
+    /**
+     * @brief Converts a residue back to its value
+     */
+    constexpr word_type decode(const word_type residue) const noexcept {
+        return residue;
+    }
+
+    /**
+     * @brief Product of two residues
+     */
+    constexpr word_type multiply(const word_type lhs, const word_type rhs)
+                                 const noexcept {
+        return reduce(static_cast<Wide>(lhs) * rhs);
+    }
+
+    /**
+     * @brief Sum of two residues
+     */
+    constexpr word_type add(const word_type lhs, const word_type rhs)
+                            const noexcept {
+        return detail::modularAdd(lhs, rhs, m_modulus);
+    }
+
+    /**
+     * @brief Difference of two residues
+     */
+    constexpr word_type subtract(const word_type lhs, const word_type rhs)
+                                 const noexcept {
+        return detail::modularSubtract(lhs, rhs, m_modulus);
+    }
+
+private:
+    using Wide = detail::ModularWide<word_type>;
+
+    static constexpr unsigned bits = std::numeric_limits<word_type>::digits;
+
+    /*
+     * Reduction of any double word value: the quotient floor(x * r / 2^2N),
+     * r = floor((2^2N - 1) / m), is computed exactly from the four partial
+     * products of the halves and undershoots x / m by less than two, so the
+     * remainder needs at most one correction
+     */
+    constexpr word_type reduce(const Wide value) const noexcept {
+        const word_type value_low       = static_cast<word_type>(value);
+        const word_type value_high      = static_cast<word_type>(value >> bits);
+        const word_type reciprocal_low  = static_cast<word_type>(m_reciprocal);
+        const word_type reciprocal_high = static_cast<word_type>(m_reciprocal >> bits);
+
+        const Wide low    = static_cast<Wide>(value_low) * reciprocal_low;
+        const Wide cross1 = static_cast<Wide>(value_high) * reciprocal_low;
+        const Wide cross2 = static_cast<Wide>(value_low) * reciprocal_high;
+        const Wide middle = (low >> bits)
+                            + static_cast<word_type>(cross1)
+                            + static_cast<word_type>(cross2);
+        const Wide quotient = static_cast<Wide>(value_high) * reciprocal_high
+                              + (cross1 >> bits) + (cross2 >> bits)
+                              + (middle >> bits);
+
+        const Wide remainder = value - quotient * m_modulus;
+        const word_type correction = static_cast<word_type>(
+            m_modulus & (word_type{} - (remainder >= m_modulus)));
+        return static_cast<word_type>(remainder - correction);
+    }
+
+    word_type m_modulus;    //< Modulus of every operation
+    Wide      m_reciprocal; //< floor((2^2N - 1) / m)
+
+}; //< BarrettModulus<T>
+
+//=========================================================================
+// Modular Integral
+//=========================================================================
+
+/**
+ * @brief Residue of an Integral<T> modulo a runtime modulus
+ *
+ * Arithmetic stays modulo the modulus the object was created with, which
+ * must outlive the object and be shared by both operands of an operation.
+ * MontgomeryModulus<T> is the faster reduction for odd moduli while
+ * BarrettModulus<T> supports any modulus.
+ */
+template<typename T, typename Modulus = BarrettModulus<T>>
+class ModIntegral final {
+
+public:
+
+    /**
+     * @brief Underlying type of the value
+     */
+    using value_type = T;
+
+    /**
+     * @brief Reduction the residue is kept under
+     */
+    using modulus_type = Modulus;
+
+    /**
+     * @brief Constructor to initialize the object with the residue of the
+     *        specified value
+     *
+     * @param modulus Modulus of the arithmetic
+     * @param value   Value to reduce
+     */
+    constexpr ModIntegral(const Modulus& modulus,
+                          const Integral<T> value = Integral<T>{}) noexcept
+    : m_modulus{&modulus},
+      m_residue{modulus.encode(static_cast<word_type>(T(value)))} {}
+
+    /**
+     * @brief Get the value of the residue, in the range [0, modulus)
+     */
+    constexpr Integral<T> value() const noexcept {
+        return Integral<T>{static_cast<T>(m_modulus->decode(m_residue))};
+    }
+
+    /**
+     * @brief Converts the object to the value of the residue
+     */
+    constexpr explicit operator Integral<T>() const noexcept {
+        return value();
+    }
+
+    /**
+     * @brief Get the modulus of the arithmetic
+     */
+    constexpr const Modulus& modulus() const noexcept {
+        return *m_modulus;
+    }
+
+    /**
+     * @brief Performs modular addition on the specified objects
+     *
+     * @param lhs Left hand operand
+     * @param rhs Right hand operand
+     *
+     * @return Result from the operation
+     */
+    friend constexpr ModIntegral operator +(const ModIntegral& lhs,
+                                            const ModIntegral& rhs) noexcept {
+        return ModIntegral{Residue{}, *lhs.m_modulus,
+                           lhs.m_modulus->add(lhs.m_residue, rhs.m_residue)};
+    }
+
+    /**
+     * @brief Performs modular subtraction on the specified objects
+     *
+     * @param lhs Left hand operand
+     * @param rhs Right hand operand
+     *
+     * @return Result from the operation
+     */
+    friend constexpr ModIntegral operator -(const ModIntegral& lhs,
+                                            const ModIntegral& rhs) noexcept {
+        return ModIntegral{Residue{}, *lhs.m_modulus,
+                           lhs.m_modulus->subtract(lhs.m_residue,
+                                                   rhs.m_residue)};
+    }
+
+    /**
+     * @brief Provides the additive inverse of the object
+     */
+    constexpr ModIntegral operator -() const noexcept {
+        return ModIntegral{Residue{}, *m_modulus,
+                           m_modulus->subtract(0, m_residue)};
+    }
+
+    /**
+     * @brief Performs modular multiplication on the specified objects
+     *
+     * @param lhs Left hand operand
+     * @param rhs Right hand operand
+     *
+     * @return Result from the operation
+     */
+    friend constexpr ModIntegral operator *(const ModIntegral& lhs,
+                                            const ModIntegral& rhs) noexcept {
+        return ModIntegral{Residue{}, *lhs.m_modulus,
+                           lhs.m_modulus->multiply(lhs.m_residue,
+                                                   rhs.m_residue)};
+    }
+
+    /**
+     * @brief Raises the object to the specified power by square and
+     *        multiply
+     *
+     * @param exponent Power to raise the object to
+     *
+     * @return Result from the operation
+     */
+    constexpr ModIntegral pow(unsigned long long exponent) const noexcept {
+        word_type result = m_modulus->encode(1);
+        word_type base   = m_residue;
+        for (; exponent != 0; exponent >>= 1) {
+            if (exponent & 1u) {
+                result = m_modulus->multiply(result, base);
+            }
+            base = m_modulus->multiply(base, base);
+        }
+        return ModIntegral{Residue{}, *m_modulus, result};
+    }
+
+    /**
+     * @brief Checks if the residues of the specified objects are equal
+     */
+    friend constexpr bool operator ==(const ModIntegral& lhs,
+                                      const ModIntegral& rhs) noexcept {
+        return lhs.m_residue == rhs.m_residue;
+    }
+
+    /**
+     * @brief Checks if the residues of the specified objects differ
+     */
+    friend constexpr bool operator !=(const ModIntegral& lhs,
+                                      const ModIntegral& rhs) noexcept {
+        return lhs.m_residue != rhs.m_residue;
+    }
+
+//=========================================================================
+// Implementation Details
+//=========================================================================
+private:
+    using word_type = typename Modulus::word_type;
+
+    /*
+     * Tag selecting the constructor from a residue
+     */
+    struct Residue {};
+
+    /*
+     * Constructor from a residue already reduced under the modulus
+     */
+    constexpr ModIntegral(Residue, const Modulus& modulus,
+                          const word_type residue) noexcept
+    : m_modulus{&modulus}, m_residue{residue} {}
+
+    const Modulus* m_modulus; //< Reduction of the arithmetic
+    word_type      m_residue; //< Residue in the form of the reduction
+
+}; //< ModIntegral<T, Modulus>
+
+/**
+ * @brief Residue arithmetic using Montgomery multiplication, odd moduli only
+ */
+template<typename T>
+using MontgomeryIntegral = ModIntegral<T, MontgomeryModulus<T>>;
+
+/**
+ * @brief Residue arithmetic using Barrett reduction
+ */
+template<typename T>
+using BarrettIntegral = ModIntegral<T, BarrettModulus<T>>;
+
+} //< namespace compuSUAVE_Professional
+
+#endif //< MOD_INTEGRAL_CSP_H__
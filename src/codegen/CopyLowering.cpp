@@ -0,0 +1,70 @@
+/*  Copyright(c) 2015, Rico Antonio Felix. All rights reserved.
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *      1. The origin of this software must not be misrepresented; you must not
+ *      claim that you wrote the original software. If you use this software
+ *      in a product, an acknowledgment in the product documentation would be
+ *      appreciated but is not required.
+ *
+ *      2. Altered source versions must be plainly marked as such, and must not
+ *      be misrepresented as being the original software.
+ *
+ *      3. This notice may not be removed or altered from any source
+ *      distribution.
+ */
+
+ /**
+  * @author Rico Antonio Felix <ricoantoniofelix@yahoo.com>
+  */
+
+/*
+ * Every copy_ function below must lower to a call of memmove, which the
+ * standard library only emits for trivially copyable element types; the
+ * codegen target disassembles this file and fails otherwise
+ */
+
+#include "../Integral.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+using namespace compuSUAVE_Professional;
+
+extern "C" {
+
+void copy_int(const Integral<int>* first, std::size_t count,
+              Integral<int>* out) {
+    std::copy(first, first + count, out);
+}
+
+void copy_uint8(const Integral<std::uint8_t>* first, std::size_t count,
+                Integral<std::uint8_t>* out) {
+    std::copy(first, first + count, out);
+}
+
+void copy_int64_saturating(
+        const Integral<std::int64_t, overflow::Saturating>* first,
+        std::size_t count, Integral<std::int64_t, overflow::Saturating>* out) {
+    std::copy(first, first + count, out);
+}
+
+void copy_backward_uint32(const Integral<std::uint32_t>* first,
+                          std::size_t count, Integral<std::uint32_t>* out) {
+    std::copy_backward(first, first + count, out + count);
+}
+
+void move_int16_checked(Integral<std::int16_t, overflow::Checked>* first,
+                        std::size_t count,
+                        Integral<std::int16_t, overflow::Checked>* out) {
+    std::move(first, first + count, out);
+}
+
+} //< extern "C"
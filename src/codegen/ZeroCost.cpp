@@ -0,0 +1,244 @@
+/*  Copyright(c) 2015, Rico Antonio Felix. All rights reserved.
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *      1. The origin of this software must not be misrepresented; you must not
+ *      claim that you wrote the original software. If you use this software
+ *      in a product, an acknowledgment in the product documentation would be
+ *      appreciated but is not required.
+ *
+ *      2. Altered source versions must be plainly marked as such, and must not
+ *      be misrepresented as being the original software.
+ *
+ *      3. This notice may not be removed or altered from any source
+ *      distribution.
+ */
+
+ /**
+  * @author Rico Antonio Felix <ricoantoniofelix@yahoo.com>
+  */
+
+/*
+ * Every operation is compiled twice, as integral_<name> on Integral<T> and
+ * as raw_<name> written by hand on T with the same results, including the
+ * wrap-around and minimum by minus one cases the default policy defines.
+ * The codegen target disassembles this file and fails when the Integral<T>
+ * version of a pair needs more instructions than the raw version, beyond
+ * the allowances of codegen/ZeroCost.allow.
+ */
+
+#include "../Integral.hpp"
+
+#include <cstdint>
+
+using namespace compuSUAVE_Professional;
+
+namespace {
+
+template<typename T>
+using U = detail::MakeUnsigned<T>;
+
+template<typename T>
+constexpr int bitsOf = static_cast<int>(sizeof(T) * 8);
+
+//=========================================================================
+// Raw Equivalents
+//=========================================================================
+
+template<typename T>
+T rawAdd(const T lhs, const T rhs) {
+    return static_cast<T>(static_cast<U<T>>(lhs) + static_cast<U<T>>(rhs));
+}
+
+template<typename T>
+T rawSub(const T lhs, const T rhs) {
+    return static_cast<T>(static_cast<U<T>>(lhs) - static_cast<U<T>>(rhs));
+}
+
+template<typename T>
+T rawMul(const T lhs, const T rhs) {
+    return static_cast<T>(1u * static_cast<U<T>>(lhs) * static_cast<U<T>>(rhs));
+}
+
+template<typename T>
+T rawNeg(const T value) {
+    return static_cast<T>(0u - static_cast<U<T>>(value));
+}
+
+template<typename T>
+T rawDiv(const T lhs, const T rhs) {
+    return (detail::IntegralTraits<T>::is_signed && (rhs == static_cast<T>(-1)))
+           ? rawNeg(lhs)
+           : static_cast<T>(lhs / rhs);
+}
+
+template<typename T>
+T rawMod(const T lhs, const T rhs) {
+    if (detail::IntegralTraits<T>::is_signed && (rhs == static_cast<T>(-1)))
+        return 0;
+    return static_cast<T>(lhs % rhs);
+}
+
+template<typename T>
+int rawCompare(const T lhs, const T rhs) {
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+template<typename T>
+int rawPopcount(const T value) {
+    return (sizeof(T) > 4)
+           ? __builtin_popcountll(static_cast<U<T>>(value))
+           : __builtin_popcount(static_cast<U<T>>(value));
+}
+
+template<typename T>
+int rawCountlZero(const T value) {
+    if (value == 0)
+        return bitsOf<T>;
+    return (sizeof(T) > 4)
+           ? __builtin_clzll(static_cast<U<T>>(value))
+           : __builtin_clz(static_cast<U<T>>(value)) - (32 - bitsOf<T>);
+}
+
+template<typename T>
+int rawCountrZero(const T value) {
+    if (value == 0)
+        return bitsOf<T>;
+    return (sizeof(T) > 4) ? __builtin_ctzll(static_cast<U<T>>(value))
+                           : __builtin_ctz(static_cast<U<T>>(value));
+}
+
+template<typename T>
+T rawRotl(const T value, const int count) {
+    const U<T> word = static_cast<U<T>>(value);
+    const unsigned left = static_cast<unsigned>(count) & (bitsOf<T> - 1u);
+    return static_cast<T>(static_cast<U<T>>(word << left)
+                          | static_cast<U<T>>(word >> ((0u - left)
+                                                       & (bitsOf<T> - 1u))));
+}
+
+std::uint32_t rawByteswap(const std::uint32_t value) {
+    return __builtin_bswap32(value);
+}
+
+std::uint64_t rawByteswap(const std::uint64_t value) {
+    return __builtin_bswap64(value);
+}
+
+} //< namespace
+
+//=========================================================================
+// Operation Pairs
+//=========================================================================
+
+#define ZERO_COST_BINARY(name, T, type, integral, raw)                      \
+    extern "C" T integral_##name##_##type(const Integral<T> lhs,            \
+                                          const Integral<T> rhs) {          \
+        return static_cast<T>(integral);                                    \
+    }                                                                       \
+    extern "C" T raw_##name##_##type(const T lhs, const T rhs) {            \
+        return static_cast<T>(raw);                                         \
+    }
+
+#define ZERO_COST_PREDICATE(name, T, type, op)                              \
+    extern "C" bool integral_##name##_##type(const Integral<T> lhs,         \
+                                             const Integral<T> rhs) {       \
+        return lhs op rhs;                                                  \
+    }                                                                       \
+    extern "C" bool raw_##name##_##type(const T lhs, const T rhs) {         \
+        return lhs op rhs;                                                  \
+    }
+
+#define ZERO_COST_UNARY(name, R, T, type, integral, raw)                    \
+    extern "C" R integral_##name##_##type(const Integral<T> value) {        \
+        return static_cast<R>(integral);                                    \
+    }                                                                       \
+    extern "C" R raw_##name##_##type(const T value) {                       \
+        return static_cast<R>(raw);                                         \
+    }
+
+#define ZERO_COST_OPERATIONS(T, type)                                        \
+    ZERO_COST_BINARY(add, T, type, lhs + rhs, rawAdd(lhs, rhs))              \
+    ZERO_COST_BINARY(sub, T, type, lhs - rhs, rawSub(lhs, rhs))              \
+    ZERO_COST_BINARY(mul, T, type, lhs * rhs, rawMul(lhs, rhs))              \
+    ZERO_COST_BINARY(div, T, type, lhs / rhs, rawDiv(lhs, rhs))              \
+    ZERO_COST_BINARY(mod, T, type, lhs % rhs, rawMod(lhs, rhs))              \
+    ZERO_COST_BINARY(min, T, type, min(lhs, rhs), (rhs < lhs) ? rhs : lhs)   \
+    ZERO_COST_BINARY(max, T, type, max(lhs, rhs), (lhs < rhs) ? rhs : lhs)   \
+    ZERO_COST_PREDICATE(eq, T, type, ==)                                     \
+    ZERO_COST_PREDICATE(ne, T, type, !=)                                     \
+    ZERO_COST_PREDICATE(lt, T, type, <)                                      \
+    ZERO_COST_PREDICATE(gt, T, type, >)                                      \
+    ZERO_COST_PREDICATE(le, T, type, <=)                                     \
+    ZERO_COST_PREDICATE(ge, T, type, >=)                                     \
+    ZERO_COST_UNARY(neg, T, T, type, -value, rawNeg(value))                  \
+    ZERO_COST_UNARY(inc, T, T, type, ++Integral<T>{value},                   \
+                    rawAdd(value, T{1}))                                     \
+    ZERO_COST_UNARY(dec, T, T, type, --Integral<T>{value},                   \
+                    rawSub(value, T{1}))                                     \
+    ZERO_COST_UNARY(odd, bool, T, type, value.odd(), (value & 1) != 0)       \
+    ZERO_COST_UNARY(popcount, int, T, type, value.popcount(),                \
+                    rawPopcount(value))                                      \
+    ZERO_COST_UNARY(countl_zero, int, T, type, value.countl_zero(),          \
+                    rawCountlZero(value))                                    \
+    ZERO_COST_UNARY(countr_zero, int, T, type, value.countr_zero(),          \
+                    rawCountrZero(value))                                    \
+    extern "C" int integral_compare_##type(const Integral<T> lhs,            \
+                                           const Integral<T> rhs) {          \
+        return compare(lhs, rhs).value();                                    \
+    }                                                                        \
+    extern "C" int raw_compare_##type(const T lhs, const T rhs) {            \
+        return rawCompare(lhs, rhs);                                         \
+    }                                                                        \
+    extern "C" T integral_rotl_##type(const Integral<T> value,               \
+                                      const int count) {                     \
+        return value.rotl(count);                                            \
+    }                                                                        \
+    extern "C" T raw_rotl_##type(const T value, const int count) {           \
+        return rawRotl(value, count);                                        \
+    }                                                                        \
+    extern "C" void integral_assign_##type(Integral<T>* target,              \
+                                           const Integral<T>* source) {      \
+        *target = *source;                                                   \
+    }                                                                        \
+    extern "C" void raw_assign_##type(T* target, const T* source) {          \
+        *target = *source;                                                   \
+    }                                                                        \
+    extern "C" void integral_assign_from_##type(Integral<T>* target,         \
+                                                const T source) {            \
+        *target = source;                                                    \
+    }                                                                        \
+    extern "C" void raw_assign_from_##type(T* target, const T source) {      \
+        *target = source;                                                    \
+    }
+
+ZERO_COST_OPERATIONS(std::int8_t,   int8)
+ZERO_COST_OPERATIONS(std::uint8_t,  uint8)
+ZERO_COST_OPERATIONS(std::int16_t,  int16)
+ZERO_COST_OPERATIONS(std::uint16_t, uint16)
+ZERO_COST_OPERATIONS(std::int32_t,  int32)
+ZERO_COST_OPERATIONS(std::uint32_t, uint32)
+ZERO_COST_OPERATIONS(std::int64_t,  int64)
+ZERO_COST_OPERATIONS(std::uint64_t, uint64)
+
+ZERO_COST_UNARY(byteswap, std::uint32_t, std::uint32_t, uint32,
+                value.byteswap(), rawByteswap(value))
+ZERO_COST_UNARY(byteswap, std::uint64_t, std::uint64_t, uint64,
+                value.byteswap(), rawByteswap(value))
+
+extern "C" std::uint64_t integral_mulhi_uint64(const Integral<std::uint64_t> lhs,
+                                               const Integral<std::uint64_t> rhs) {
+    return mulhi(lhs, rhs);
+}
+
+extern "C" std::uint64_t raw_mulhi_uint64(const std::uint64_t lhs,
+                                          const std::uint64_t rhs) {
+    return static_cast<std::uint64_t>(
+        (static_cast<unsigned __int128>(lhs) * rhs) >> 64);
+}
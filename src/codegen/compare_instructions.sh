@@ -0,0 +1,63 @@
+#!/bin/sh
+#
+# Usage: compare_instructions.sh OBJECT [ALLOWANCES]
+#
+# Pairs every integral_NAME function of OBJECT with raw_NAME and fails when
+# the Integral<T> version needs more instructions than the raw version, by
+# more than the allowance ALLOWANCES lists for it. OBJECT should be built
+# with -ffunction-sections so no alignment padding is counted.
+
+object="$1"
+allowances="${2:-/dev/null}"
+
+{ grep -v '^#' "$allowances" | sed 's/^/allow /'
+  objdump -d --no-show-raw-insn "$object"; } | awk '
+    $1 == "allow" && NF == 3 { allowed[$2] = $3; next }
+    /^[0-9a-f]+ <[A-Za-z0-9_]+>:$/ {
+        name = $2
+        gsub(/[<>:]/, "", name)
+        counts[name] = 0
+        next
+    }
+    /^ +[0-9a-f]+:\t/ && name != "" {
+        if ($0 !~ /\t(nop|xchg +%ax,%ax|cs nop|data16)/)
+            ++counts[name]
+    }
+    END {
+        failed = 0
+        pairs = 0
+        for (name in counts) {
+            if (name !~ /^integral_/)
+                continue
+            raw = name
+            sub(/^integral_/, "raw_", raw)
+            if (!(raw in counts)) {
+                printf "MISSING   %s\n", raw
+                failed = 1
+                continue
+            }
+            ++pairs
+            extra = counts[name] - counts[raw]
+            allowance = (name in allowed) ? allowed[name] : 0
+            if (extra > allowance) {
+                printf "DIVERGED  %-28s %3d vs %3d raw\n", name, counts[name], counts[raw]
+                failed = 1
+            } else if ((name in allowed) && (extra < allowance)) {
+                printf "IMPROVED  %-28s %3d vs %3d raw, lower its allowance\n", name, counts[name], counts[raw]
+            } else if (extra < 0) {
+                printf "FEWER     %-28s %3d vs %3d raw\n", name, counts[name], counts[raw]
+            }
+        }
+        for (name in allowed) {
+            if (!(name in counts)) {
+                printf "UNKNOWN   %s in allowances\n", name
+                failed = 1
+            }
+        }
+        if (pairs == 0) {
+            print "no integral_ functions found"
+            failed = 1
+        }
+        printf "%d pairs compared\n", pairs
+        exit failed
+    }'
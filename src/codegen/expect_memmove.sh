@@ -0,0 +1,34 @@
+#!/bin/sh
+#
+# Usage: expect_memmove.sh OBJECT
+#
+# Fails unless every copy_ and move_ function of OBJECT calls memmove
+
+object="$1"
+
+objdump -dr --no-show-raw-insn "$object" | awk '
+    /^[0-9a-f]+ <(copy|move)_[A-Za-z0-9_]*>:$/ {
+        name = $2
+        gsub(/[<>:]/, "", name)
+        names[++count] = name
+        lowered[name] = 0
+        next
+    }
+    /^[0-9a-f]+ <.*>:$/ { name = ""; next }
+    name != "" && /memmove/ { lowered[name] = 1 }
+    END {
+        failed = 0
+        for (i = 1; i <= count; ++i) {
+            if (lowered[names[i]]) {
+                printf "memmove   %s\n", names[i]
+            } else {
+                printf "NO MEMMOVE %s\n", names[i]
+                failed = 1
+            }
+        }
+        if (count == 0) {
+            print "no copy_ or move_ functions found"
+            failed = 1
+        }
+        exit failed
+    }'